@@ -1,38 +1,522 @@
 #ifndef GRAPH_TOOLKIT_ALGORITHMS_H
 #define GRAPH_TOOLKIT_ALGORITHMS_H
 
+#include "CsrGraph.h"
+#include "DistanceMatrix.h"
 #include "Graph.h"
+#include "MaskedGraphView.h"
+#include <concepts>
+#include <cstdint>
+#include <functional>
+#include <limits>
 #include <utility>
 #include <vector>
 
+/**
+ * @brief Lower bound on the remaining distance from a vertex to the search target.
+ *
+ * Heuristics passed to aStar must be consistent: h(target) == 0 and h(u) <= w(u, v) + h(v) for
+ * every edge (u, v). Consistency implies admissibility.
+ */
+using Heuristic = std::function<int(size_t)>;
+
+/**
+ * @brief Distance types the shortest-path routines are instantiated for.
+ *
+ * Edge weights are always int; the distance type only sets how path lengths are accumulated. int
+ * is the most cache-dense and throws std::overflow_error instead of wrapping around, int64_t cannot
+ * overflow on any graph with fewer than 2^32 edges, and float/double trade exactness for range.
+ */
+template <typename Distance>
+concept DistanceType = std::same_as<Distance, int> || std::same_as<Distance, std::int64_t>
+    || std::same_as<Distance, float> || std::same_as<Distance, double>;
+
+/**
+ * @brief Gets the distance reported for unreachable vertices.
+ * @return The maximum value for integer types (INT_MAX for int), +infinity for floating point.
+ */
+template <DistanceType Distance> constexpr Distance unreachableDistance()
+{
+    if constexpr (std::numeric_limits<Distance>::has_infinity)
+        return std::numeric_limits<Distance>::infinity();
+    else
+        return std::numeric_limits<Distance>::max();
+}
+
+template <DistanceType Distance> class BasicShortestPathWorkspace;
+
+/**
+ * @brief Workspace accumulating int distances, the default for every shortest-path routine.
+ */
+using ShortestPathWorkspace = BasicShortestPathWorkspace<int>;
+
+template <DistanceType Distance>
+void dijkstra(
+    const CsrGraph& graph, size_t source, BasicShortestPathWorkspace<Distance>& workspace);
+
+template <DistanceType Distance>
+void aStar(const CsrGraph& graph, size_t source, size_t target, const Heuristic& heuristic,
+    BasicShortestPathWorkspace<Distance>& workspace);
+
+template <DistanceType Distance>
+void dijkstra(const MaskedGraphView& view, size_t source, size_t target,
+    BasicShortestPathWorkspace<Distance>& workspace);
+
+/**
+ * @brief Callback receiving the result of one source of a batchDijkstra run.
+ *
+ * The first argument is the index into the sources vector, the second holds the distances and
+ * predecessors for that source. The workspace is reused as soon as the callback returns.
+ */
+using BatchCallback = std::function<void(size_t, const ShortestPathWorkspace&)>;
+
+/**
+ * @brief Reusable scratch space for repeated shortest-path searches on a CsrGraph.
+ *
+ * Entries are stamped with the epoch of the run that wrote them, so starting a new run costs O(1)
+ * instead of clearing O(V) distance and predecessor arrays, and the heap keeps its capacity. One
+ * workspace must not be shared between concurrent searches.
+ *
+ * @tparam Distance Type used to accumulate path lengths.
+ */
+template <DistanceType Distance> class BasicShortestPathWorkspace {
+private:
+    std::vector<Distance> dist;
+    std::vector<int> pred;
+    std::vector<std::uint32_t> reachedEpoch;
+    std::vector<std::uint32_t> settledEpoch;
+    std::uint32_t epoch;
+    std::vector<int> settledOrder;
+    std::vector<std::pair<Distance, int>> heap;
+
+    /**
+     * @brief Best-first search shared by dijkstra and aStar.
+     * @param graph The graph to search.
+     * @param source The source vertex.
+     * @param target Vertex at which the search stops once settled, or >= n to settle everything.
+     * @param heuristic Consistent lower bound added to heap keys, or nullptr for plain Dijkstra.
+     * @param allowed Predicate taking an edge id and its head; edges it rejects are skipped.
+     */
+    template <typename EdgeFilter>
+    void search(const CsrGraph& graph, size_t source, size_t target, const Heuristic* heuristic,
+        const EdgeFilter& allowed);
+
+    friend void dijkstra<Distance>(
+        const CsrGraph& graph, size_t source, BasicShortestPathWorkspace& workspace);
+    friend void aStar<Distance>(const CsrGraph& graph, size_t source, size_t target,
+        const Heuristic& heuristic, BasicShortestPathWorkspace& workspace);
+    friend void dijkstra<Distance>(const MaskedGraphView& view, size_t source, size_t target,
+        BasicShortestPathWorkspace& workspace);
+
+public:
+    /**
+     * @brief Default constructor, creates an empty workspace that sizes itself on first use.
+     */
+    BasicShortestPathWorkspace();
+
+    /**
+     * @brief Gets the number of vertices of the last searched graph.
+     * @return Number of vertices.
+     */
+    size_t getNumVertices() const;
+
+    /**
+     * @brief Gets the distance of a vertex found by the last search.
+     * @param vertex Vertex to query.
+     * @return The distance, or unreachableDistance() if the last search did not reach vertex.
+     * @throws std::out_of_range if vertex is out of range.
+     */
+    Distance getDistance(size_t vertex) const;
+
+    /**
+     * @brief Gets the predecessor of a vertex found by the last search.
+     * @param vertex Vertex to query.
+     * @return The predecessor, or -1 for the source and unreached vertices.
+     * @throws std::out_of_range if vertex is out of range.
+     */
+    int getPredecessor(size_t vertex) const;
+
+    /**
+     * @brief Gets the vertices settled by the last search, in the order they were settled.
+     * @return Vector of vertex indices in non-decreasing distance order for dijkstra.
+     */
+    const std::vector<int>& getSettled() const;
+
+    /**
+     * @brief Copies the distances of the last search into a dense vector.
+     * @return Distance to every vertex, unreachableDistance() where unreached.
+     */
+    std::vector<Distance> distances() const;
+
+    /**
+     * @brief Copies the predecessors of the last search into a dense vector.
+     * @return Predecessor of every vertex, -1 for the source and unreached vertices.
+     */
+    std::vector<int> predecessors() const;
+};
+
 /**
  * @brief Computes shortest paths from a source vertex using Dijkstra's algorithm.
+ * @tparam Distance Type used to accumulate path lengths, int by default.
+ * @param graph The input graph (must have non-negative weights).
+ * @param source The source vertex.
+ * @return A pair of {distances, predecessors} from the source vertex.
+ * @throws std::invalid_argument if the graph has negative weights.
+ * @throws std::overflow_error if a path length does not fit an int Distance.
+ *
+ * @note Uses a binary heap for O(E log V) complexity on a CsrGraph snapshot of the input.
+ */
+template <DistanceType Distance = int>
+std::pair<std::vector<Distance>, std::vector<int>> dijkstra(const Graph& graph, size_t source);
+
+/**
+ * @brief Runs Dijkstra's algorithm on a frozen graph into a reusable workspace.
+ * @param graph The input graph (must have non-negative weights).
+ * @param source The source vertex.
+ * @param workspace Workspace receiving the distances, predecessors and settle order.
+ * @throws std::out_of_range if the source vertex is out of range.
+ * @throws std::invalid_argument if the graph has negative weights.
+ * @throws std::overflow_error if a path length does not fit an int Distance.
+ *
+ * @note Allocation-free once the workspace has grown to the graph's size.
+ */
+template <DistanceType Distance>
+void dijkstra(
+    const CsrGraph& graph, size_t source, BasicShortestPathWorkspace<Distance>& workspace);
+
+/**
+ * @brief Runs Dijkstra's algorithm on a masked view of a graph, stopping early at a target.
+ * @param view The graph with hidden edges and vertices (must have non-negative weights).
+ * @param source The source vertex; searched even if hidden.
+ * @param target Vertex at which the search stops once settled, or >= n to settle everything.
+ * @param workspace Workspace receiving the distances, predecessors and settle order.
+ * @throws std::out_of_range if the source vertex is out of range.
+ * @throws std::invalid_argument if the graph has negative weights.
+ * @throws std::overflow_error if a path length does not fit an int Distance.
+ *
+ * @note Hidden edges are skipped and hidden vertices are never entered, so repeated searches on
+ * subgraphs (e.g. spur searches in kShortestPaths) need no graph copies.
+ */
+template <DistanceType Distance>
+void dijkstra(const MaskedGraphView& view, size_t source, size_t target,
+    BasicShortestPathWorkspace<Distance>& workspace);
+
+/**
+ * @brief Runs Dijkstra's algorithm from many sources.
+ * @param graph The input graph (must have non-negative weights).
+ * @param sources Source vertices.
+ * @param numThreads Number of worker threads, 0 for one per hardware thread.
+ * @return Distance matrix with one row per source, INT_MAX where unreachable.
+ * @throws std::out_of_range if a source vertex is out of range.
+ * @throws std::invalid_argument if the graph has negative weights.
+ */
+std::vector<std::vector<int>> batchDijkstra(
+    const Graph& graph, const std::vector<int>& sources, size_t numThreads = 0);
+
+/**
+ * @brief Runs Dijkstra's algorithm from many sources, streaming each result to a callback.
+ * @param graph The input graph (must have non-negative weights).
+ * @param sources Source vertices.
+ * @param callback Called once per source from the worker that computed it; must be thread-safe.
+ * @param numThreads Number of worker threads, 0 for one per hardware thread.
+ * @throws std::out_of_range if a source vertex is out of range.
+ * @throws std::invalid_argument if the graph has negative weights.
+ *
+ * @note Each worker reuses one ShortestPathWorkspace for all of its sources.
+ */
+void batchDijkstra(const CsrGraph& graph, const std::vector<int>& sources,
+    const BatchCallback& callback, size_t numThreads = 0);
+
+/**
+ * @brief Computes a shortest path from source to target using A* search.
  * @param graph The input graph (must have non-negative weights).
  * @param source The source vertex.
+ * @param target The target vertex; the search stops as soon as it is settled.
+ * @param heuristic Consistent lower bound on the distance from a vertex to target.
  * @return A pair of {distances, predecessors} from the source vertex.
+ * @throws std::out_of_range if source or target is out of range.
+ * @throws std::invalid_argument if the graph has negative weights.
+ *
+ * @note Only dist[target] and the predecessor chain back from target are guaranteed final; other
+ * vertices hold tentative values or INT_MAX if never reached. With a zero heuristic this behaves
+ * like dijkstra with early exit at target.
+ */
+std::pair<std::vector<int>, std::vector<int>> aStar(
+    const Graph& graph, size_t source, size_t target, const Heuristic& heuristic);
+
+/**
+ * @brief Runs A* search on a frozen graph into a reusable workspace.
+ * @param graph The input graph (must have non-negative weights).
+ * @param source The source vertex.
+ * @param target The target vertex; the search stops as soon as it is settled.
+ * @param heuristic Consistent lower bound on the distance from a vertex to target.
+ * @param workspace Workspace receiving the distances, predecessors and settle order.
+ * @throws std::out_of_range if source or target is out of range.
+ * @throws std::invalid_argument if the graph has negative weights.
+ * @throws std::overflow_error if a path length does not fit an int Distance.
+ */
+template <DistanceType Distance>
+void aStar(const CsrGraph& graph, size_t source, size_t target, const Heuristic& heuristic,
+    BasicShortestPathWorkspace<Distance>& workspace);
+
+/**
+ * @brief Builds a Euclidean-distance heuristic from planar vertex coordinates.
+ * @param coordinates The {x, y} position of every vertex.
+ * @param target The target vertex of the search.
+ * @return A heuristic returning the floored straight-line distance to target.
+ * @throws std::out_of_range if target has no coordinates; the heuristic throws it for any
+ * vertex without coordinates.
+ *
+ * @note Consistent only if every edge weight is at least the straight-line length of the edge.
+ */
+Heuristic euclideanHeuristic(
+    const std::vector<std::pair<double, double>>& coordinates, size_t target);
+
+/**
+ * @brief Builds a landmark (ALT) heuristic from precomputed shortest-path distances.
+ * @param landmarkDistances One dijkstra distance vector per landmark, measured from the landmark.
+ * @param target The target vertex of the search.
+ * @return A heuristic returning max over landmarks L of dist(L, target) - dist(L, v), or 0.
+ * @throws std::out_of_range if target is out of range for any distance table; the heuristic
+ * throws it for any such vertex.
+ *
+ * @note The bound follows from the triangle inequality and is consistent on any graph.
+ */
+Heuristic landmarkHeuristic(const std::vector<std::vector<int>>& landmarkDistances, size_t target);
+
+/**
+ * @brief Kind of paths enumerated by kShortestPaths.
+ */
+enum class KShortestPathsMode {
+    Loopless, ///< Yen's algorithm: simple paths only.
+    Walks ///< Eppstein-style sidetrack enumeration: paths may revisit vertices.
+};
+
+/**
+ * @brief Finds the k shortest paths between two vertices of a frozen graph.
+ * @param graph The input graph (must have non-negative weights).
+ * @param source The source vertex.
+ * @param target The target vertex.
+ * @param k Maximum number of paths to return.
+ * @param mode Whether paths must be simple.
+ * @param numThreads Number of worker threads for the spur searches, 0 for one per hardware thread.
+ * @return Up to k pairs of {vertices from source to target, length}, by non-decreasing length.
+ * @throws std::out_of_range if source or target is out of range.
  * @throws std::invalid_argument if the graph has negative weights.
  *
- * @note Uses std::priority_queue for O(E log V) complexity.
+ * @note Loopless runs Yen's algorithm. The spur searches of each round are independent and run in
+ * parallel, each worker reusing one MaskedGraphView and one workspace. Walks computes the shortest
+ * path tree into target once and represents every path implicitly by its sidetrack edges (edges
+ * off the tree) with a parent pointer, so no search is repeated; it runs on the calling thread.
+ * Paths are distinguished by their vertex sequences in Loopless mode and by their edges in Walks
+ * mode.
+ */
+std::vector<std::pair<std::vector<int>, int>> kShortestPaths(const CsrGraph& graph, size_t source,
+    size_t target, size_t k, KShortestPathsMode mode = KShortestPathsMode::Loopless,
+    size_t numThreads = 0);
+
+/**
+ * @brief Finds the k shortest paths between two vertices.
+ * @param graph The input graph.
+ * @param source The source vertex.
+ * @param target The target vertex.
+ * @param k Maximum number of paths to return.
+ * @param mode Whether paths must be simple.
+ * @param numThreads Number of worker threads for the spur searches, 0 for one per hardware thread.
+ * @return Up to k pairs of {vertices from source to target, length}, by non-decreasing length.
+ * @throws std::out_of_range if source or target is out of range.
  */
-std::pair<std::vector<int>, std::vector<int>> dijkstra(const Graph& graph, size_t source);
+std::vector<std::pair<std::vector<int>, int>> kShortestPaths(const Graph& graph, size_t source,
+    size_t target, size_t k, KShortestPathsMode mode = KShortestPathsMode::Loopless,
+    size_t numThreads = 0);
+
+/**
+ * @brief Relaxation strategy used by bellmanFord.
+ */
+enum class BellmanFordMode {
+    FullPasses, ///< Always run n - 1 passes over every edge, then a negative-cycle pass.
+    EarlyExit, ///< Stop as soon as a full pass makes no update.
+    Queue ///< SPFA: only relax edges leaving vertices whose distance changed.
+};
 
 /**
  * @brief Computes shortest paths from a source vertex using Bellman-Ford algorithm.
+ * @tparam Distance Type used to accumulate path lengths, int by default.
+ * @param graph The input graph.
+ * @param source The source vertex.
+ * @param mode Relaxation strategy; all modes produce the same distances.
+ * @return A pair of {distances, predecessors} from the source vertex.
+ * @throws std::runtime_error if a negative cycle is detected.
+ * @throws std::overflow_error if a path length does not fit an int Distance.
+ *
+ * @note Supports negative edge weights. EarlyExit finishes in one pass more than the largest
+ * number of edges on a shortest path; Queue detects negative cycles once a vertex has been
+ * enqueued more than n times.
+ */
+template <DistanceType Distance = int>
+std::pair<std::vector<Distance>, std::vector<int>> bellmanFord(
+    const Graph& graph, size_t source, BellmanFordMode mode = BellmanFordMode::EarlyExit);
+
+/**
+ * @brief Computes shortest paths from a source vertex of a frozen graph using Bellman-Ford.
+ * @tparam Distance Type used to accumulate path lengths, int by default.
+ * @param graph The input graph.
+ * @param source The source vertex.
+ * @param mode Relaxation strategy; all modes produce the same distances.
+ * @return A pair of {distances, predecessors} from the source vertex.
+ * @throws std::out_of_range if the source vertex is out of range.
+ * @throws std::runtime_error if a negative cycle is detected.
+ * @throws std::overflow_error if a path length does not fit an int Distance.
+ */
+template <DistanceType Distance = int>
+std::pair<std::vector<Distance>, std::vector<int>> bellmanFord(
+    const CsrGraph& graph, size_t source, BellmanFordMode mode = BellmanFordMode::EarlyExit);
+
+/**
+ * @brief Computes shortest paths with a parallel, deterministic edge-centric Bellman-Ford.
  * @param graph The input graph.
  * @param source The source vertex.
+ * @param numThreads Number of worker threads, 0 for one per hardware thread.
  * @return A pair of {distances, predecessors} from the source vertex.
+ * @throws std::out_of_range if the source vertex is out of range.
  * @throws std::runtime_error if a negative cycle is detected.
+ * @throws std::overflow_error if a path length overflows int.
+ *
+ * @note The transposed CSR graph holds the edges in one contiguous array grouped by head vertex,
+ * and is read in place. Each thread owns a range of heads with a similar number of edges. Every
+ * round reads the previous round's distances and writes a second buffer (Jacobi iteration), so no
+ * atomics are needed and the result does not depend on the thread count. Stops after the first
+ * round without updates.
+ */
+std::pair<std::vector<int>, std::vector<int>> parallelBellmanFord(
+    const CsrGraph& graph, size_t source, size_t numThreads = 0);
+
+/**
+ * @brief Computes all-pairs shortest paths using Johnson's algorithm.
+ * @param graph The input graph.
+ * @param layout Memory layout of the result.
+ * @param width Storage width of the result entries.
+ * @param numThreads Number of worker threads, 0 for one per hardware thread.
+ * @return Matrix whose entry (u, v) is dist(u, v), INT_MAX where unreachable.
+ * @throws std::runtime_error if the graph contains a negative cycle.
+ * @throws std::overflow_error if a distance does not fit the storage width, or a reweighted edge
+ * does not fit an int.
+ *
+ * @note If the graph has negative weights, one Bellman-Ford pass from a virtual source computes
+ * potentials h that make every reweighted edge w(u, v) + h(u) - h(v) non-negative. Dijkstra then
+ * runs from every vertex through batchDijkstra, one reusable workspace per thread, and each row
+ * is corrected back and written straight into the matrix. O(VE log V / threads) overall.
+ */
+DistanceMatrix johnson(const CsrGraph& graph, MatrixLayout layout = MatrixLayout::RowMajor,
+    DistanceWidth width = DistanceWidth::Int32, size_t numThreads = 0);
+
+/**
+ * @brief Computes all-pairs shortest paths of a Graph using Johnson's algorithm.
+ * @param graph The input graph.
+ * @param layout Memory layout of the result.
+ * @param width Storage width of the result entries.
+ * @param numThreads Number of worker threads, 0 for one per hardware thread.
+ * @return Matrix whose entry (u, v) is dist(u, v), INT_MAX where unreachable.
+ * @throws std::overflow_error if a distance does not fit the storage width.
+ */
+DistanceMatrix johnson(const Graph& graph, MatrixLayout layout = MatrixLayout::RowMajor,
+    DistanceWidth width = DistanceWidth::Int32, size_t numThreads = 0);
+
+/**
+ * @brief Computes all-pairs shortest paths of a dense graph with a cache-blocked Floyd-Warshall.
+ * @param graph The input graph.
+ * @param predecessors If non-null, receives an n * n row-major matrix whose entry u * n + v is the
+ * vertex before v on a shortest path from u, or -1 if v == u or v is unreachable from u.
+ * @param numThreads Number of worker threads, 0 for one per hardware thread.
+ * @return A Blocked, 32-bit matrix whose entry (u, v) is dist(u, v), INT_MAX where unreachable.
+ * @throws std::overflow_error if an edge weight or a shortest distance reaches 2^30 - 1.
  *
- * @note Supports negative edge weights.
+ * @note The matrix is processed in BLOCK_SIZE x BLOCK_SIZE tiles. For each pivot tile, the tiles
+ * in its row and column and then all remaining tiles are independent and are updated in parallel.
+ * The min-plus inner loop uses AVX-512 or AVX2 when the CPU supports them, with a scalar fallback.
+ * O(V^3 / threads) time.
  */
-std::pair<std::vector<int>, std::vector<int>> bellmanFord(const Graph& graph, size_t source);
+DistanceMatrix floydWarshall(
+    const Graph& graph, std::vector<int>* predecessors = nullptr, size_t numThreads = 0);
 
 /**
  * @brief Returns vertices in topological order using Kahn's algorithm.
  * @param graph The input directed acyclic graph.
  * @return Vector of vertex indices in topological order.
  * @throws std::runtime_error if the graph contains a cycle.
+ *
+ * @note Recomputes the order from scratch; a DAG built one edge at a time is better served by
+ * IncrementalTopologicalOrder.
  */
 std::vector<int> topologicalSort(const Graph& graph);
 
+/**
+ * @brief Returns vertices in topological order using Kahn's algorithm.
+ * @param graph The input directed acyclic graph.
+ * @return Vector of vertex indices in topological order.
+ * @throws std::runtime_error if the graph contains a cycle.
+ */
+std::vector<int> topologicalSort(const CsrGraph& graph);
+
+/**
+ * @brief Splits a DAG into levels (antichains) with a parallel level-synchronous Kahn's algorithm.
+ * @param graph The input directed acyclic graph.
+ * @param numThreads Number of worker threads, 0 for one per hardware thread.
+ * @return Levels in order; level 0 holds the vertices without in-edges and every other vertex
+ * sits one level below its latest predecessor, so the vertices of a level can run concurrently.
+ * @throws std::runtime_error if the graph contains a cycle.
+ *
+ * @note In-degrees are decremented with atomic fetch-sub, and the worker whose decrement reaches
+ * zero appends the vertex to its own next-level buffer. The buffers are concatenated at a
+ * barrier. Levels smaller than a few thousand vertices are expanded by one thread without
+ * synchronizing, so long narrow chains do not pay a barrier per level. The order within a level
+ * depends on scheduling.
+ */
+std::vector<std::vector<int>> topologicalLevels(const CsrGraph& graph, size_t numThreads = 0);
+
+/**
+ * @brief Splits a DAG into levels (antichains) with a parallel level-synchronous Kahn's algorithm.
+ * @param graph The input directed acyclic graph.
+ * @param numThreads Number of worker threads, 0 for one per hardware thread.
+ * @return Levels in order, each an antichain of vertices that can run concurrently.
+ * @throws std::runtime_error if the graph contains a cycle.
+ */
+std::vector<std::vector<int>> topologicalLevels(const Graph& graph, size_t numThreads = 0);
+
+/**
+ * @brief Longest (critical) path of a weighted DAG.
+ */
+struct CriticalPathResult {
+    std::vector<int> lengths; ///< Weight of the longest path ending at each vertex, at least 0.
+    std::vector<int> predecessors; ///< Previous vertex on that path, -1 if it is the vertex alone.
+    std::vector<int> path; ///< A longest path of the whole DAG, first vertex to last.
+    int length = 0; ///< Total weight of path.
+};
+
+/**
+ * @brief Computes the critical path of a weighted DAG, for scheduling with edge durations.
+ * @param graph The input directed acyclic graph; weights may be negative.
+ * @param numThreads Number of worker threads, 0 for one per hardware thread.
+ * @return Longest path lengths and predecessors of every vertex, and the overall critical path.
+ * @throws std::runtime_error if the graph contains a cycle.
+ * @throws std::overflow_error if a path length overflows int.
+ *
+ * @note Processes topologicalLevels in order. Each vertex pulls from its in-edges, whose tails
+ * all lie in earlier levels, so the vertices of a level are independent and large levels run in
+ * parallel without atomics. The single-vertex path of length 0 counts, so an in-edge is only
+ * taken if it yields a positive length. Ties keep the first in-neighbor; the path ends at the
+ * smallest vertex of maximal length. lengths[v] is the earliest start time of task v.
+ */
+CriticalPathResult criticalPath(const CsrGraph& graph, size_t numThreads = 0);
+
+/**
+ * @brief Computes the critical path of a weighted DAG.
+ * @param graph The input directed acyclic graph.
+ * @param numThreads Number of worker threads, 0 for one per hardware thread.
+ * @return Longest path lengths and predecessors of every vertex, and the overall critical path.
+ * @throws std::runtime_error if the graph contains a cycle.
+ * @throws std::overflow_error if a path length overflows int.
+ */
+CriticalPathResult criticalPath(const Graph& graph, size_t numThreads = 0);
+
 #endif // GRAPH_TOOLKIT_ALGORITHMS_H
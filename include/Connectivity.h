@@ -0,0 +1,78 @@
+#ifndef GRAPH_TOOLKIT_CONNECTIVITY_H
+#define GRAPH_TOOLKIT_CONNECTIVITY_H
+
+#include "CsrGraph.h"
+#include "Graph.h"
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Biconnected components, articulation points and bridges of a graph.
+ *
+ * Edge directions are ignored and parallel edges and self-loops are dropped, so an undirected
+ * edge stored in both directions counts once. Every list is sorted, so results of the sequential
+ * and parallel algorithms compare equal.
+ */
+struct BiconnectedResult {
+    std::vector<std::vector<int>> components; ///< Vertices of each biconnected component.
+    std::vector<int> articulationPoints; ///< Vertices whose removal disconnects their component.
+    std::vector<std::pair<int, int>> bridges; ///< Edges (u, v), u < v, whose removal does.
+};
+
+/**
+ * @brief Labels the connected components of a frozen graph in parallel with Afforest.
+ * @param graph The input graph; edge directions are ignored (weakly connected components).
+ * @param numThreads Number of worker threads, 0 for one per hardware thread.
+ * @return The component label of every vertex: the smallest vertex index in its component, so
+ * labels do not depend on the thread count and a vertex v is a representative iff label[v] == v.
+ *
+ * @note Components are merged in a lock-free union-find whose links always point from the larger
+ * to the smaller root, installed with a compare-and-swap. The first two out-edges of every vertex
+ * are linked first; a random sample then identifies the largest intermediate component, and the
+ * remaining edges are linked while skipping those whose endpoints both already belong to it. On
+ * graphs with a giant component most edges are skipped after a single label read.
+ */
+std::vector<int> connectedComponents(const CsrGraph& graph, size_t numThreads = 0);
+
+/**
+ * @brief Labels the connected components of a graph in parallel with Afforest.
+ * @param graph The input graph; edge directions are ignored (weakly connected components).
+ * @param numThreads Number of worker threads, 0 for one per hardware thread.
+ * @return The component label of every vertex: the smallest vertex index in its component.
+ */
+std::vector<int> connectedComponents(const Graph& graph, size_t numThreads = 0);
+
+/**
+ * @brief Finds biconnected components, articulation points and bridges with Hopcroft-Tarjan.
+ * @param graph The input graph; edge directions are ignored.
+ * @return The components, articulation points and bridges.
+ *
+ * @note Runs in O(V + E log d) for maximum degree d, the log factor from merging edge directions
+ * into sorted neighbor lists. The depth-first search keeps its own stack of frames, so paths of
+ * millions of vertices do not overflow the call stack. An isolated vertex belongs to no
+ * component; a bridge forms a component of its own.
+ */
+BiconnectedResult biconnectedComponents(const CsrGraph& graph);
+
+/**
+ * @brief Finds biconnected components, articulation points and bridges with Hopcroft-Tarjan.
+ * @param graph The input graph; edge directions are ignored.
+ * @return The components, articulation points and bridges.
+ */
+BiconnectedResult biconnectedComponents(const Graph& graph);
+
+/**
+ * @brief Finds biconnected components, articulation points and bridges with Tarjan-Vishkin.
+ * @param graph The input graph; edge directions are ignored.
+ * @param numThreads Number of worker threads, 0 for one per hardware thread.
+ * @return The same result as biconnectedComponents.
+ *
+ * @note Works on any spanning forest instead of a depth-first one. Each tree edge stands for its
+ * child vertex. Two tree edges are merged in a ConcurrentUnionFind when a non-tree edge joins
+ * unrelated subtrees. A child's edge is also merged with its parent's edge when the child's
+ * subtree has a non-tree edge leaving the parent's subtree. The passes over the edges run in
+ * parallel. Building the BFS forest and the O(V) passes over it run sequentially.
+ */
+BiconnectedResult parallelBiconnectedComponents(const CsrGraph& graph, size_t numThreads = 0);
+
+#endif // GRAPH_TOOLKIT_CONNECTIVITY_H
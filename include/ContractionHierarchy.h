@@ -0,0 +1,121 @@
+#ifndef GRAPH_TOOLKIT_CONTRACTION_HIERARCHY_H
+#define GRAPH_TOOLKIT_CONTRACTION_HIERARCHY_H
+
+#include "CsrGraph.h"
+#include "Graph.h"
+#include <iosfwd>
+#include <vector>
+
+/**
+ * @brief Contraction Hierarchies index for fast point-to-point shortest-path queries.
+ *
+ * Preprocessing contracts vertices in edge-difference order, inserting shortcuts that preserve
+ * shortest-path distances. Queries then run a bidirectional Dijkstra that only relaxes edges
+ * towards higher-ranked vertices, which settles a tiny fraction of the graph on road-like inputs.
+ * The index can be saved to and loaded from a binary stream.
+ */
+class ContractionHierarchy {
+private:
+    size_t numVertices;
+    size_t numShortcuts;
+    std::vector<int> rank;
+    CsrGraph upward; // u -> v with rank[u] < rank[v], searched forward from the source
+    CsrGraph downward; // v -> u for each edge u -> v with rank[u] > rank[v], searched backward
+    std::vector<int> upwardMiddle; // contracted vertex a shortcut bypasses, -1 for original edges
+    std::vector<int> downwardMiddle;
+
+    /**
+     * @brief Runs the bidirectional upward search between two vertices.
+     * @param source Source vertex.
+     * @param target Target vertex.
+     * @param path If non-null, receives the unpacked vertex sequence of a shortest path.
+     * @return The shortest-path distance, or INT_MAX if target is unreachable.
+     */
+    int query(size_t source, size_t target, std::vector<int>* path) const;
+
+    /**
+     * @brief Appends the original-edge vertices of a (possibly shortcut) edge, excluding from.
+     * @param from Tail of the edge.
+     * @param to Head of the edge.
+     * @param middle Middle vertex of the edge, -1 for an original edge.
+     * @param path Path to append to.
+     */
+    void unpackEdge(int from, int to, int middle, std::vector<int>& path) const;
+
+public:
+    /**
+     * @brief Default constructor, creates an empty hierarchy.
+     */
+    ContractionHierarchy();
+
+    /**
+     * @brief Contracts every vertex of a graph and builds the search graphs.
+     * @param graph The input graph (must have non-negative weights).
+     * @param numThreads Number of worker threads, 0 for one per hardware thread.
+     * @throws std::invalid_argument if the graph has negative weights.
+     * @throws std::overflow_error if a shortcut's length does not fit an int.
+     *
+     * @note Each round contracts an independent set of vertices whose priority is a local minimum;
+     * witness searches and priority updates within a round run in parallel.
+     */
+    explicit ContractionHierarchy(const Graph& graph, size_t numThreads = 0);
+
+    /**
+     * @brief Gets the number of vertices the hierarchy was built for.
+     * @return Number of vertices.
+     */
+    size_t getNumVertices() const;
+
+    /**
+     * @brief Gets the number of shortcut edges added during contraction.
+     * @return Number of shortcuts.
+     */
+    size_t getNumShortcuts() const;
+
+    /**
+     * @brief Gets the contraction rank of a vertex (0 is contracted first).
+     * @param vertex Vertex to query.
+     * @return Rank of vertex.
+     * @throws std::out_of_range if vertex is out of range.
+     */
+    int getRank(size_t vertex) const;
+
+    /**
+     * @brief Computes the shortest-path distance between two vertices.
+     * @param source Source vertex.
+     * @param target Target vertex.
+     * @return The distance, or INT_MAX if target is unreachable.
+     * @throws std::out_of_range if either vertex is out of range.
+     * @throws std::overflow_error if a path length does not fit an int.
+     */
+    int distance(size_t source, size_t target) const;
+
+    /**
+     * @brief Computes a shortest path between two vertices, unpacking all shortcuts.
+     * @param source Source vertex.
+     * @param target Target vertex.
+     * @return Vertices of the path from source to target, empty if target is unreachable.
+     * @throws std::out_of_range if either vertex is out of range.
+     * @throws std::overflow_error if a path length does not fit an int.
+     */
+    std::vector<int> shortestPath(size_t source, size_t target) const;
+
+    /**
+     * @brief Writes the hierarchy to a binary stream.
+     * @param out Output stream, opened in binary mode.
+     * @throws std::runtime_error if writing fails.
+     *
+     * @note The format uses the host byte order.
+     */
+    void save(std::ostream& out) const;
+
+    /**
+     * @brief Reads a hierarchy previously written by save.
+     * @param in Input stream, opened in binary mode.
+     * @return The loaded hierarchy.
+     * @throws std::runtime_error if the stream is truncated or not a contraction hierarchy.
+     */
+    static ContractionHierarchy load(std::istream& in);
+};
+
+#endif // GRAPH_TOOLKIT_CONTRACTION_HIERARCHY_H
@@ -0,0 +1,123 @@
+#ifndef GRAPH_TOOLKIT_CSR_GRAPH_H
+#define GRAPH_TOOLKIT_CSR_GRAPH_H
+
+#include "Graph.h"
+#include <span>
+#include <vector>
+
+/**
+ * @brief Immutable compressed sparse row (CSR) snapshot of a directed weighted graph.
+ *
+ * The outgoing edges of vertex v occupy the contiguous edge ids [edgeBegin(v), edgeEnd(v)), so
+ * neighbor scans are O(out-degree) with no allocation. Use it to freeze a Graph before running
+ * many queries, or to hold derived search graphs.
+ */
+class CsrGraph {
+public:
+    /**
+     * @brief A directed weighted edge used to build a CsrGraph.
+     */
+    struct Edge {
+        int from;
+        int to;
+        int weight;
+    };
+
+private:
+    size_t numVertices;
+    std::vector<size_t> offsets;
+    std::vector<int> targets;
+    std::vector<int> weights;
+    bool negativeWeights;
+
+    /**
+     * @brief Checks if a vertex index is valid for this graph.
+     * @param vertex Vertex index to check.
+     * @return true if vertex is within valid range, false otherwise.
+     */
+    bool validVertex(size_t vertex) const noexcept;
+
+public:
+    /**
+     * @brief Default constructor, creates an empty graph.
+     */
+    CsrGraph();
+
+    /**
+     * @brief Freezes a Graph, listing each vertex's neighbors in increasing order.
+     * @param graph Graph to snapshot.
+     */
+    explicit CsrGraph(const Graph& graph);
+
+    /**
+     * @brief Builds a graph from an edge list.
+     * @param vertices Number of vertices.
+     * @param edges Directed edges; edges of the same source keep their input order.
+     * @throws std::out_of_range if an edge endpoint is out of range.
+     */
+    CsrGraph(size_t vertices, const std::vector<Edge>& edges);
+
+    /**
+     * @brief Gets the number of vertices in the graph.
+     * @return Number of vertices.
+     */
+    size_t getNumVertices() const;
+
+    /**
+     * @brief Gets the number of edges in the graph.
+     * @return Number of edges.
+     */
+    size_t getNumEdges() const;
+
+    /**
+     * @brief Checks if any edge has a negative weight, computed once at construction.
+     * @return true if the graph has a negative edge weight.
+     */
+    bool hasNegativeWeights() const;
+
+    /**
+     * @brief Gets the id of the first outgoing edge of a vertex.
+     * @param vertex Source vertex.
+     * @return First edge id of vertex.
+     * @throws std::out_of_range if vertex is out of range.
+     */
+    size_t edgeBegin(size_t vertex) const;
+
+    /**
+     * @brief Gets one past the id of the last outgoing edge of a vertex.
+     * @param vertex Source vertex.
+     * @return One past the last edge id of vertex.
+     * @throws std::out_of_range if vertex is out of range.
+     */
+    size_t edgeEnd(size_t vertex) const;
+
+    /**
+     * @brief Gets the targets of all outgoing edges of a vertex.
+     * @param vertex Source vertex.
+     * @return View of neighbor indices, aligned with getWeights(vertex).
+     * @throws std::out_of_range if vertex is out of range.
+     */
+    std::span<const int> getNeighbors(size_t vertex) const;
+
+    /**
+     * @brief Gets the weights of all outgoing edges of a vertex.
+     * @param vertex Source vertex.
+     * @return View of edge weights, aligned with getNeighbors(vertex).
+     * @throws std::out_of_range if vertex is out of range.
+     */
+    std::span<const int> getWeights(size_t vertex) const;
+
+    /**
+     * @brief Lists every edge in edge-id order.
+     * @return Vector of edges.
+     */
+    std::vector<Edge> getEdges() const;
+
+    /**
+     * @brief Builds the transpose graph, with every edge reversed and weights preserved.
+     * @return The transposed CsrGraph.
+     */
+    CsrGraph transpose() const;
+};
+
+#endif // GRAPH_TOOLKIT_CSR_GRAPH_H
@@ -0,0 +1,142 @@
+#ifndef GRAPH_TOOLKIT_DISTANCE_MATRIX_H
+#define GRAPH_TOOLKIT_DISTANCE_MATRIX_H
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+/**
+ * @brief Memory layout of a DistanceMatrix.
+ */
+enum class MatrixLayout {
+    RowMajor, ///< Row by row; getRow is a contiguous copy.
+    Blocked ///< Square tiles of BLOCK_SIZE x BLOCK_SIZE entries, each stored row-major.
+};
+
+/**
+ * @brief Storage width of the entries of a DistanceMatrix.
+ */
+enum class DistanceWidth {
+    Int32, ///< 4 bytes per entry, holds any int distance.
+    Int16 ///< 2 bytes per entry, holds distances in [-32768, 32766].
+};
+
+/**
+ * @brief Dense all-pairs distance matrix with a compact, selectable storage format.
+ *
+ * Every entry starts out unreachable. Entries are read and written as int, with INT_MAX standing
+ * for "unreachable" regardless of the storage width. Distinct entries may be written concurrently.
+ */
+class DistanceMatrix {
+public:
+    /**
+     * @brief Side length of the tiles used by the Blocked layout.
+     */
+    static constexpr size_t BLOCK_SIZE = 64;
+
+private:
+    size_t numVertices;
+    MatrixLayout layout;
+    DistanceWidth width;
+    size_t blocksPerRow;
+    std::vector<std::int32_t> wide;
+    std::vector<std::int16_t> narrow;
+
+    /**
+     * @brief Computes the storage index of an entry.
+     * @param from Row (source vertex).
+     * @param to Column (target vertex).
+     * @return Index into the active storage vector.
+     */
+    size_t offset(size_t from, size_t to) const noexcept;
+
+public:
+    /**
+     * @brief Default constructor, creates an empty matrix.
+     */
+    DistanceMatrix();
+
+    /**
+     * @brief Creates a matrix with every entry unreachable.
+     * @param vertices Number of rows and columns.
+     * @param layout Memory layout.
+     * @param width Storage width of each entry.
+     *
+     * @note The Blocked layout pads both dimensions to a multiple of BLOCK_SIZE.
+     */
+    explicit DistanceMatrix(size_t vertices, MatrixLayout layout = MatrixLayout::RowMajor,
+        DistanceWidth width = DistanceWidth::Int32);
+
+    /**
+     * @brief Gets the number of rows (and columns) of the matrix.
+     * @return Number of vertices.
+     */
+    size_t getNumVertices() const;
+
+    /**
+     * @brief Gets the memory layout of the matrix.
+     * @return The layout.
+     */
+    MatrixLayout getLayout() const;
+
+    /**
+     * @brief Gets the storage width of the entries.
+     * @return The width.
+     */
+    DistanceWidth getWidth() const;
+
+    /**
+     * @brief Gets the number of bytes used by the entries, including padding.
+     * @return Size of the storage in bytes.
+     */
+    size_t getMemoryUsage() const;
+
+    /**
+     * @brief Reads one entry.
+     * @param from Source vertex.
+     * @param to Target vertex.
+     * @return The distance, or INT_MAX if unreachable.
+     * @throws std::out_of_range if either vertex is out of range.
+     */
+    int get(size_t from, size_t to) const;
+
+    /**
+     * @brief Writes one entry.
+     * @param from Source vertex.
+     * @param to Target vertex.
+     * @param distance The distance, or INT_MAX for unreachable.
+     * @throws std::out_of_range if either vertex is out of range.
+     * @throws std::overflow_error if distance does not fit the storage width.
+     */
+    void set(size_t from, size_t to, int distance);
+
+    /**
+     * @brief Gets the number of tiles per row (and column) of the Blocked layout.
+     * @return ceil(vertices / BLOCK_SIZE).
+     */
+    size_t getNumBlocks() const;
+
+    /**
+     * @brief Gets the raw entries of one tile of a 32-bit Blocked matrix.
+     * @param blockRow Tile row.
+     * @param blockColumn Tile column.
+     * @return View of BLOCK_SIZE * BLOCK_SIZE entries, row-major within the tile. Padding entries
+     * past the last vertex are included.
+     * @throws std::logic_error if the matrix is not Blocked with Int32 entries.
+     * @throws std::out_of_range if either tile index is out of range.
+     *
+     * @note Meant for cache-blocked kernels; unreachable entries hold INT_MAX.
+     */
+    std::span<std::int32_t> getTile(size_t blockRow, size_t blockColumn);
+
+    /**
+     * @brief Copies one row into a dense vector.
+     * @param from Source vertex.
+     * @return Distance from the source to every vertex, INT_MAX where unreachable.
+     * @throws std::out_of_range if from is out of range.
+     */
+    std::vector<int> getRow(size_t from) const;
+};
+
+#endif // GRAPH_TOOLKIT_DISTANCE_MATRIX_H
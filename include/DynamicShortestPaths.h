@@ -0,0 +1,146 @@
+#ifndef GRAPH_TOOLKIT_DYNAMIC_SHORTEST_PATHS_H
+#define GRAPH_TOOLKIT_DYNAMIC_SHORTEST_PATHS_H
+
+#include "CsrGraph.h"
+#include "Graph.h"
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Single-source shortest paths kept up to date as edges change.
+ *
+ * The object owns its own adjacency lists and the {dist, pred} arrays of the shortest-path tree.
+ * Inserting an edge or lowering its weight runs Dijkstra only over the vertices whose distance
+ * improves. Removing a tree edge or raising its weight invalidates the subtree below it, which is
+ * re-seeded from its unaffected in-neighbors and settled again; changes to non-tree edges that
+ * cannot shorten anything cost O(degree).
+ */
+class DynamicShortestPaths {
+private:
+    struct Arc {
+        int other;
+        int weight;
+    };
+
+    size_t source;
+    std::vector<std::vector<Arc>> out;
+    std::vector<std::vector<Arc>> in;
+    std::vector<int> dist;
+    std::vector<int> pred;
+    std::vector<std::uint32_t> affectedStamp;
+    std::uint32_t generation;
+    size_t lastRepairSize;
+
+    /**
+     * @brief Checks if a vertex index is valid for this graph.
+     * @param vertex Vertex index to check.
+     * @return true if vertex is within valid range, false otherwise.
+     */
+    bool validVertex(size_t vertex) const noexcept;
+
+    /**
+     * @brief Builds the adjacency lists and computes the initial tree.
+     * @param vertices Number of vertices.
+     * @param edges Directed edges; parallel edges keep the lightest weight.
+     */
+    void initialize(size_t vertices, const std::vector<CsrGraph::Edge>& edges);
+
+    /**
+     * @brief Settles vertices from a heap of tentative distances, relaxing their out-arcs.
+     * @param heap Min-heap of {distance, vertex} entries whose dist is already set.
+     * @return Number of vertices settled.
+     */
+    size_t settle(std::vector<std::pair<int, int>>& heap);
+
+    /**
+     * @brief Recomputes the distances of a vertex's subtree after its tree arc got worse.
+     * @param root Head of the tree arc that was removed or made heavier.
+     */
+    void repairSubtree(size_t root);
+
+public:
+    /**
+     * @brief Computes the initial shortest-path tree of a graph.
+     * @param graph The input graph.
+     * @param source The source vertex.
+     * @throws std::out_of_range if source is out of range.
+     */
+    DynamicShortestPaths(const Graph& graph, size_t source);
+
+    /**
+     * @brief Computes the initial shortest-path tree of a frozen graph.
+     * @param graph The input graph (must have non-negative weights).
+     * @param source The source vertex.
+     * @throws std::out_of_range if source is out of range.
+     * @throws std::invalid_argument if the graph has negative weights.
+     *
+     * @note Parallel edges are collapsed into one edge of the lightest weight.
+     */
+    DynamicShortestPaths(const CsrGraph& graph, size_t source);
+
+    /**
+     * @brief Gets the number of vertices.
+     * @return Number of vertices.
+     */
+    size_t getNumVertices() const;
+
+    /**
+     * @brief Gets the source vertex.
+     * @return The source vertex.
+     */
+    size_t getSource() const;
+
+    /**
+     * @brief Gets the current distance of a vertex.
+     * @param vertex Vertex to query.
+     * @return The distance from the source, or INT_MAX if vertex is unreachable.
+     * @throws std::out_of_range if vertex is out of range.
+     */
+    int getDistance(size_t vertex) const;
+
+    /**
+     * @brief Gets the current predecessor of a vertex on the shortest-path tree.
+     * @param vertex Vertex to query.
+     * @return The predecessor, or -1 for the source and unreachable vertices.
+     * @throws std::out_of_range if vertex is out of range.
+     */
+    int getPredecessor(size_t vertex) const;
+
+    /**
+     * @brief Gets the current distances of all vertices.
+     * @return Distance to every vertex, INT_MAX where unreachable.
+     */
+    const std::vector<int>& distances() const;
+
+    /**
+     * @brief Gets the current predecessors of all vertices.
+     * @return Predecessor of every vertex, -1 for the source and unreachable vertices.
+     */
+    const std::vector<int>& predecessors() const;
+
+    /**
+     * @brief Gets the number of vertices whose distance was recomputed by the last update.
+     * @return Size of the repaired region, 0 if the update changed nothing.
+     */
+    size_t getLastRepairSize() const;
+
+    /**
+     * @brief Adds an edge, or changes its weight if it already exists, and repairs the tree.
+     * @param from Source vertex.
+     * @param to Destination vertex.
+     * @param weight New edge weight.
+     * @throws std::out_of_range if either vertex is out of range.
+     * @throws std::invalid_argument if weight is negative.
+     */
+    void addEdge(size_t from, size_t to, int weight);
+
+    /**
+     * @brief Removes an edge, if present, and repairs the tree.
+     * @param from Source vertex.
+     * @param to Destination vertex.
+     * @throws std::out_of_range if either vertex is out of range.
+     */
+    void removeEdge(size_t from, size_t to);
+};
+
+#endif // GRAPH_TOOLKIT_DYNAMIC_SHORTEST_PATHS_H
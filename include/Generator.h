@@ -0,0 +1,136 @@
+#ifndef GRAPH_TOOLKIT_GENERATOR_H
+#define GRAPH_TOOLKIT_GENERATOR_H
+
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <memory>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+
+/**
+ * @brief Lazy input range produced by a coroutine that co_yields values of type T.
+ *
+ * A minimal stand-in for C++23 std::generator. The coroutine starts suspended and runs to its next
+ * co_yield each time the iterator is incremented, so values are computed only as they are
+ * consumed; its frame is allocated once, when the coroutine is called. Exceptions thrown by the
+ * coroutine propagate out of begin() or operator++. Generators are move-only and single-pass.
+ *
+ * @tparam T Type of the yielded values.
+ */
+template <typename T> class Generator : public std::ranges::view_base {
+public:
+    struct promise_type {
+        const T* current = nullptr;
+        std::exception_ptr exception;
+
+        Generator get_return_object()
+        {
+            return Generator(std::coroutine_handle<promise_type>::from_promise(*this));
+        }
+
+        std::suspend_always initial_suspend() noexcept { return {}; }
+        std::suspend_always final_suspend() noexcept { return {}; }
+
+        // The yielded operand lives until the coroutine resumes, so pointing at it is safe.
+        std::suspend_always yield_value(const T& value) noexcept
+        {
+            current = std::addressof(value);
+            return {};
+        }
+
+        void return_void() noexcept { }
+        void unhandled_exception() { exception = std::current_exception(); }
+
+        // co_await is not meaningful inside a generator.
+        template <typename U> std::suspend_never await_transform(U&&) = delete;
+    };
+
+    /**
+     * @brief Input iterator resuming the coroutine on every increment.
+     */
+    class Iterator {
+    private:
+        std::coroutine_handle<promise_type> handle;
+
+    public:
+        using iterator_concept = std::input_iterator_tag;
+        using value_type = std::remove_cvref_t<T>;
+        using difference_type = std::ptrdiff_t;
+
+        Iterator() = default;
+
+        explicit Iterator(std::coroutine_handle<promise_type> handle)
+            : handle(handle)
+        {
+        }
+
+        const T& operator*() const { return *handle.promise().current; }
+
+        Iterator& operator++()
+        {
+            handle.resume();
+            if (handle.promise().exception)
+                std::rethrow_exception(std::exchange(handle.promise().exception, nullptr));
+            return *this;
+        }
+
+        void operator++(int) { ++*this; }
+
+        bool operator==(std::default_sentinel_t) const { return !handle || handle.done(); }
+    };
+
+    Generator() = default;
+
+    Generator(Generator&& other) noexcept
+        : handle(std::exchange(other.handle, nullptr))
+    {
+    }
+
+    Generator& operator=(Generator&& other) noexcept
+    {
+        if (this != &other) {
+            if (handle)
+                handle.destroy();
+            handle = std::exchange(other.handle, nullptr);
+        }
+        return *this;
+    }
+
+    Generator(const Generator&) = delete;
+    Generator& operator=(const Generator&) = delete;
+
+    ~Generator()
+    {
+        if (handle)
+            handle.destroy();
+    }
+
+    /**
+     * @brief Runs the coroutine to its first co_yield.
+     * @return Iterator at the first value, or equal to end() if nothing was yielded.
+     *
+     * @note Call at most once; the range is single-pass.
+     */
+    Iterator begin()
+    {
+        Iterator first(handle);
+        if (handle)
+            ++first;
+        return first;
+    }
+
+    std::default_sentinel_t end() const noexcept { return {}; }
+
+private:
+    std::coroutine_handle<promise_type> handle;
+
+    explicit Generator(std::coroutine_handle<promise_type> handle)
+        : handle(handle)
+    {
+    }
+};
+
+#endif // GRAPH_TOOLKIT_GENERATOR_H
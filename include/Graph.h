@@ -1,9 +1,14 @@
 #ifndef GRAPH_TOOLKIT_GRAPH_H
 #define GRAPH_TOOLKIT_GRAPH_H
 
+#include "Generator.h"
+#include "UnionFind.h"
 #include <algorithm>
+#include <atomic>
 #include <cmath>
+#include <cstdint>
 #include <iostream>
+#include <mutex>
 #include <queue>
 #include <sstream>
 #include <stack>
@@ -11,12 +16,111 @@
 #include <string>
 #include <vector>
 
+/**
+ * @brief What a traversal does after a visitor event.
+ */
+enum class TraversalControl {
+    Continue, ///< Proceed normally.
+    Prune, ///< Do not follow this edge, or do not expand this vertex's out-edges.
+    Stop ///< End the traversal immediately.
+};
+
+/**
+ * @brief Callbacks invoked by Graph::depthFirstVisit and Graph::breadthFirstVisit.
+ *
+ * Every event defaults to TraversalControl::Continue, so visitors override only what they need.
+ */
+class TraversalVisitor {
+public:
+    virtual ~TraversalVisitor() = default;
+
+    /**
+     * @brief Called when a vertex is reached for the first time, the start vertex included.
+     * @param vertex The discovered vertex.
+     * @return Prune to leave the vertex's out-edges unexamined, Stop to end the traversal.
+     */
+    virtual TraversalControl discoverVertex(size_t vertex);
+
+    /**
+     * @brief Called for every out-edge of an expanded vertex, before its head is checked.
+     * @param from Tail of the edge, the vertex being expanded.
+     * @param to Head of the edge.
+     * @return Prune to not follow the edge, Stop to end the traversal.
+     */
+    virtual TraversalControl examineEdge(size_t from, size_t to);
+
+    /**
+     * @brief Called once every out-edge of a vertex has been examined; in DFS, once all of its
+     * descendants are finished too.
+     * @param vertex The finished vertex.
+     * @return Stop to end the traversal; Prune acts like Continue.
+     */
+    virtual TraversalControl finishVertex(size_t vertex);
+};
+
+/**
+ * @brief Reusable scratch space for traversals of a Graph.
+ *
+ * Visited marks are stamped with the generation of the traversal that set them, so starting a new
+ * traversal costs O(1) instead of clearing O(V) flags, and the DFS stack, BFS queue and result
+ * buffer keep their capacity between calls. A workspace adapts to graphs of any size and can be
+ * reused across graphs; one workspace per thread, it must not be shared by concurrent traversals.
+ */
+class TraversalWorkspace {
+private:
+    std::vector<std::uint32_t> visitedStamp;
+    std::uint32_t generation;
+    std::vector<std::pair<size_t, size_t>> frames;
+    std::vector<int> queue;
+    std::vector<int> order;
+
+    /**
+     * @brief Starts a traversal: grows the arrays if needed and forgets all visited marks.
+     * @param vertices Number of vertices of the graph about to be traversed.
+     */
+    void reset(size_t vertices);
+
+    /**
+     * @brief Checks if a vertex was visited by the current traversal.
+     * @param vertex Vertex index, below the size passed to reset().
+     * @return true if the vertex is marked.
+     */
+    bool isVisited(size_t vertex) const noexcept { return visitedStamp[vertex] == generation; }
+
+    /**
+     * @brief Marks a vertex as visited by the current traversal.
+     * @param vertex Vertex index, below the size passed to reset().
+     */
+    void markVisited(size_t vertex) noexcept { visitedStamp[vertex] = generation; }
+
+    friend class Graph;
+
+public:
+    /**
+     * @brief Default constructor, creates an empty workspace that sizes itself on first use.
+     */
+    TraversalWorkspace();
+
+    /**
+     * @brief Gets the vertices produced by the last traversal that filled the workspace.
+     * @return Vertices in traversal order; overwritten by the next traversal.
+     */
+    const std::vector<int>& getOrder() const;
+};
+
 class Graph {
 private:
     size_t numVertices;
     bool isWeighted;
     std::vector<std::vector<int>> adjacencyMatrix;
 
+    // Weakly connected components, maintained by edge insertions and rebuilt after removals.
+    mutable ConcurrentUnionFind weakComponents;
+    // Edges u -> v with u != v whose reverse v -> u is absent; 0 means the graph is undirected.
+    mutable size_t asymmetricEdges;
+    mutable std::atomic<bool> connectivityStale;
+    mutable std::mutex connectivityMutex;
+
     /**
      * @brief Checks if a vertex index is valid for this graph.
      * @param vertex Vertex index to check.
@@ -24,23 +128,68 @@ private:
      */
     bool validVertex(size_t vertex) const noexcept;
 
+    /**
+     * @brief Updates the connectivity state for an edge about to be inserted.
+     * @param from Source vertex, already validated.
+     * @param to Destination vertex, already validated.
+     */
+    void trackEdgeInsertion(size_t from, size_t to);
+
+    /**
+     * @brief Rebuilds the connectivity state from the adjacency matrix if a removal invalidated it.
+     *
+     * @note Safe to call from concurrent const queries; one caller rebuilds under a mutex.
+     */
+    void refreshConnectivity() const;
+
+    /**
+     * @brief Depth-first traversal core shared by every DFS-based query.
+     * @param startVertex Starting vertex for the traversal; skipped if already visited.
+     * @param workspace Workspace holding the visited marks and the DFS stack.
+     * @param visitor Receives the traversal events.
+     * @return false if the visitor stopped the traversal, true otherwise.
+     */
+    bool depthFirstVisitHelper(
+        size_t startVertex, TraversalWorkspace& workspace, TraversalVisitor& visitor) const;
+
+    /**
+     * @brief Breadth-first traversal core shared by every BFS-based query.
+     * @param workspace Workspace whose queue holds discovered vertices to expand, already marked.
+     * @param visitor Receives the traversal events.
+     * @return false if the visitor stopped the traversal, true otherwise.
+     */
+    bool breadthFirstVisitHelper(TraversalWorkspace& workspace, TraversalVisitor& visitor) const;
+
+    /**
+     * @brief Coroutine body of depthFirstRange.
+     * @param startVertex Starting vertex for the traversal, already validated.
+     * @return Generator yielding vertices in DFS order.
+     */
+    Generator<int> depthFirstGenerator(size_t startVertex) const;
+
+    /**
+     * @brief Coroutine body of breadthFirstRange.
+     * @param startVertex Starting vertex for the traversal, already validated.
+     * @return Generator yielding vertices in BFS order.
+     */
+    Generator<int> breadthFirstGenerator(size_t startVertex) const;
+
     /**
      * @brief Helper function for depth-first traversal.
      * @param startVertex Starting vertex for the traversal.
-     * @param visited Vector tracking visited vertices.
-     * @return Vector containing vertices in DFS order.
+     * @param workspace Workspace receiving the vertices in DFS order.
      */
-    std::vector<int> depthFirstTraversalHelper(
-        size_t startVertex, std::vector<bool>& visited) const;
+    void depthFirstTraversalHelper(size_t startVertex, TraversalWorkspace& workspace) const;
 
     /**
      * @brief Helper function for breadth-first traversal.
-     * @param visited Vector tracking visited vertices.
-     * @param toTraverse Queue of vertices to process.
-     * @return Vector containing vertices in BFS order.
+     * @param workspace Workspace whose queue holds the start vertices, already marked; receives the
+     * vertices in BFS order.
+     * @param maxDepth Vertices this many hops from the start vertices are reported but not
+     * expanded; SIZE_MAX for an unbounded traversal.
      */
-    std::vector<int> breadthFirstTraversalHelper(
-        std::vector<bool>& visited, std::queue<int>& toTraverse) const;
+    void breadthFirstTraversalHelper(
+        TraversalWorkspace& workspace, size_t maxDepth = SIZE_MAX) const;
 
     /**
      * @brief Helper function for finding hamiltonian cycles.
@@ -183,12 +332,79 @@ public:
      */
     size_t getDegree(size_t vertex) const;
 
+    /**
+     * @brief Builds the transpose graph, with every edge reversed and weights preserved.
+     * @return A Graph with an edge v -> u of weight w for every edge u -> v of weight w.
+     */
+    Graph transpose() const;
+
+    /**
+     * @brief Finds the vertices within k hops of a vertex, following out-edges.
+     * @param vertex The center vertex.
+     * @param k Maximum number of hops.
+     * @return The vertices in BFS order, starting with vertex itself.
+     * @throws std::out_of_range if vertex is out of range.
+     *
+     * @note The BFS stops expanding at depth k, so only the neighborhood's own rows are scanned.
+     */
+    std::vector<int> kHopNeighborhood(size_t vertex, size_t k) const;
+
+    /**
+     * @brief Finds the vertices within k hops of a vertex, reusing a traversal workspace.
+     * @param vertex The center vertex.
+     * @param k Maximum number of hops.
+     * @param workspace Workspace reused across calls.
+     * @return The workspace's order buffer, holding the vertices in BFS order.
+     * @throws std::out_of_range if vertex is out of range.
+     */
+    const std::vector<int>& kHopNeighborhood(
+        size_t vertex, size_t k, TraversalWorkspace& workspace) const;
+
+    /**
+     * @brief Extracts the subgraph induced by the k-hop neighborhood of a vertex.
+     * @param vertex The center vertex.
+     * @param k Maximum number of hops.
+     * @param vertices If non-null, receives the original index of each subgraph vertex.
+     * @return A graph whose vertex i is the i-th vertex of kHopNeighborhood(vertex, k), with every
+     * edge of this graph between two neighborhood vertices and the same weights.
+     * @throws std::out_of_range if vertex is out of range.
+     */
+    Graph egoNetwork(size_t vertex, size_t k, std::vector<int>* vertices = nullptr) const;
+
     /**
      * @brief Checks if the graph is connected.
-     * @return true if graph is connected.
+     * @return true if some vertex reaches every vertex; for undirected graphs, if the graph is
+     * connected.
+     *
+     * @note O(1) when the weakly connected components already rule the graph out or every edge
+     * has its reverse. Otherwise runs a depth-first forest over all vertices and one search from
+     * its last root, two linear passes in total. Use connectedComponents for per-vertex component
+     * labels.
      */
     bool isConnected() const;
 
+    /**
+     * @brief Checks if two vertices are connected when edge directions are ignored.
+     * @param u The first vertex.
+     * @param v The second vertex.
+     * @return True if an undirected path joins u and v.
+     * @throws std::out_of_range if either vertex is out of range.
+     *
+     * @note Near O(1): edge insertions merge components in a lock-free union-find, so queries
+     * between insertions never traverse the graph. Removing an edge whose reverse is absent, or a
+     * vertex, makes the next connectivity query rebuild the structure in O(V^2). Concurrent const
+     * queries are safe.
+     */
+    bool areVerticesConnected(size_t u, size_t v) const;
+
+    /**
+     * @brief Counts the weakly connected components.
+     * @return Number of components when edge directions are ignored.
+     *
+     * @note O(1) between removals, like areVerticesConnected.
+     */
+    size_t getNumConnectedComponents() const;
+
     /**
      * @brief Checks if the graph is strongly connected.
      * @return true if graph is strongly connected.
@@ -200,9 +416,22 @@ public:
      * @param u The first vertex.
      * @param v The second vertex.
      * @return True if there is a path from u to v and a path from v to u; otherwise, false.
+     *
+     * @note Runs two searches per call; for many queries on a fixed graph build a
+     * ReachabilityIndex once instead.
      */
     bool areVerticesStronglyConnected(size_t u, size_t v) const;
 
+    /**
+     * @brief Checks if two vertices are strongly connected, reusing a traversal workspace.
+     * @param u The first vertex.
+     * @param v The second vertex.
+     * @param workspace Workspace reused by both searches.
+     * @return True if there is a path from u to v and a path from v to u; otherwise, false.
+     * @throws std::out_of_range if either vertex is out of range.
+     */
+    bool areVerticesStronglyConnected(size_t u, size_t v, TraversalWorkspace& workspace) const;
+
     /**
      * @brief Checks if the graph contains a cycle.
      * @return true if graph has a cycle.
@@ -257,6 +486,96 @@ public:
      */
     std::vector<int> breadthFirstTraversal(size_t startVertex) const;
 
+    /**
+     * @brief Performs a depth-first traversal into a reusable workspace.
+     * @param startVertex Starting vertex for traversal.
+     * @param workspace Workspace reused across calls.
+     * @return The workspace's order buffer, holding the vertices in DFS order.
+     * @throws std::out_of_range if startVertex is out of range.
+     *
+     * @note Allocation-free once the workspace has grown to the graph's size.
+     */
+    const std::vector<int>& depthFirstTraversal(
+        size_t startVertex, TraversalWorkspace& workspace) const;
+
+    /**
+     * @brief Performs a breadth-first traversal into a reusable workspace.
+     * @param startVertex Starting vertex for traversal.
+     * @param workspace Workspace reused across calls.
+     * @return The workspace's order buffer, holding the vertices in BFS order.
+     * @throws std::out_of_range if startVertex is out of range.
+     *
+     * @note Allocation-free once the workspace has grown to the graph's size.
+     */
+    const std::vector<int>& breadthFirstTraversal(
+        size_t startVertex, TraversalWorkspace& workspace) const;
+
+    /**
+     * @brief Runs a depth-first traversal, reporting events to a visitor.
+     * @param startVertex Starting vertex for traversal.
+     * @param visitor Receives discover, examine-edge and finish events.
+     * @return false if the visitor stopped the traversal, true otherwise.
+     * @throws std::out_of_range if startVertex is out of range.
+     *
+     * @note Vertices are discovered in the same order as depthFirstTraversal.
+     */
+    bool depthFirstVisit(size_t startVertex, TraversalVisitor& visitor) const;
+
+    /**
+     * @brief Runs a depth-first traversal with a visitor, reusing a traversal workspace.
+     * @param startVertex Starting vertex for traversal.
+     * @param visitor Receives discover, examine-edge and finish events.
+     * @param workspace Workspace reused across calls.
+     * @return false if the visitor stopped the traversal, true otherwise.
+     * @throws std::out_of_range if startVertex is out of range.
+     */
+    bool depthFirstVisit(
+        size_t startVertex, TraversalVisitor& visitor, TraversalWorkspace& workspace) const;
+
+    /**
+     * @brief Runs a breadth-first traversal, reporting events to a visitor.
+     * @param startVertex Starting vertex for traversal.
+     * @param visitor Receives discover, examine-edge and finish events.
+     * @return false if the visitor stopped the traversal, true otherwise.
+     * @throws std::out_of_range if startVertex is out of range.
+     *
+     * @note Vertices are discovered when first queued, in the same order as breadthFirstTraversal.
+     */
+    bool breadthFirstVisit(size_t startVertex, TraversalVisitor& visitor) const;
+
+    /**
+     * @brief Runs a breadth-first traversal with a visitor, reusing a traversal workspace.
+     * @param startVertex Starting vertex for traversal.
+     * @param visitor Receives discover, examine-edge and finish events.
+     * @param workspace Workspace reused across calls.
+     * @return false if the visitor stopped the traversal, true otherwise.
+     * @throws std::out_of_range if startVertex is out of range.
+     */
+    bool breadthFirstVisit(
+        size_t startVertex, TraversalVisitor& visitor, TraversalWorkspace& workspace) const;
+
+    /**
+     * @brief Lazily yields the vertices of a depth-first traversal.
+     * @param startVertex Starting vertex for traversal.
+     * @return Single-pass range of vertices in the same order as depthFirstTraversal.
+     * @throws std::out_of_range if startVertex is out of range.
+     *
+     * @note Each vertex is computed when the range is advanced, so stopping after k vertices
+     * does only the work needed for them. The graph must outlive the range and must not be
+     * modified while it is iterated.
+     */
+    Generator<int> depthFirstRange(size_t startVertex) const;
+
+    /**
+     * @brief Lazily yields the vertices of a breadth-first traversal.
+     * @param startVertex Starting vertex for traversal.
+     * @return Single-pass range of vertices in the same order as breadthFirstTraversal.
+     * @throws std::out_of_range if startVertex is out of range.
+     *
+     * @note The graph must outlive the range and must not be modified while it is iterated.
+     */
+    Generator<int> breadthFirstRange(size_t startVertex) const;
+
     /**
      * @brief Clears all vertices and edges from the graph.
      */
@@ -0,0 +1,149 @@
+#ifndef GRAPH_TOOLKIT_INCREMENTAL_TOPOLOGICAL_ORDER_H
+#define GRAPH_TOOLKIT_INCREMENTAL_TOPOLOGICAL_ORDER_H
+
+#include "CsrGraph.h"
+#include "Graph.h"
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Topological order of a DAG kept valid as edges are inserted, with Pearce-Kelly.
+ *
+ * The object owns its own adjacency lists and a bijection between vertices and positions. An
+ * inserted edge that already points forward in the order costs O(degree). An edge u -> v that
+ * points backward is handled by two bounded searches. The first goes forward from v over vertices
+ * positioned before u and fails fast if it reaches u, in which case the edge would close a cycle
+ * and is rejected. The second goes backward from u over vertices positioned after v. Only the
+ * vertices found are reordered, reusing their own positions, so the work is proportional to the
+ * affected region instead of the whole graph.
+ */
+class IncrementalTopologicalOrder {
+private:
+    std::vector<std::vector<int>> out;
+    std::vector<std::vector<int>> in;
+    std::vector<int> position; // position[v] = index of v in the order
+    std::vector<int> vertexAt; // vertexAt[i] = vertex at index i
+    std::vector<std::uint32_t> visitedStamp;
+    std::uint32_t generation;
+    std::vector<int> forward; // vertices reached from the new edge's head
+    std::vector<int> backward; // vertices reaching the new edge's tail
+    std::vector<int> stack;
+    std::vector<int> slots;
+    size_t lastReorderSize;
+
+    /**
+     * @brief Checks if a vertex index is valid for this graph.
+     * @param vertex Vertex index to check.
+     * @return true if vertex is within valid range, false otherwise.
+     */
+    bool validVertex(size_t vertex) const noexcept;
+
+    /**
+     * @brief Builds the adjacency lists and the initial order with Kahn's algorithm.
+     * @param vertices Number of vertices.
+     * @param edges Directed edges; parallel edges are merged.
+     * @throws std::runtime_error if the edges contain a cycle.
+     */
+    void initialize(size_t vertices, const std::vector<CsrGraph::Edge>& edges);
+
+    /**
+     * @brief Collects the vertices reachable from start that are positioned before a bound.
+     * @param start Head of the new edge.
+     * @param bound Position of the new edge's tail.
+     * @return false if the tail itself is reachable, i.e. the edge would close a cycle.
+     */
+    bool searchForward(int start, int bound);
+
+    /**
+     * @brief Collects the vertices reaching start that are positioned after a bound.
+     * @param start Tail of the new edge.
+     * @param bound Position of the new edge's head.
+     */
+    void searchBackward(int start, int bound);
+
+    /**
+     * @brief Moves the backward set before the forward set within their combined positions.
+     */
+    void reorder();
+
+public:
+    /**
+     * @brief Creates an order over isolated vertices, in index order.
+     * @param vertices Number of vertices.
+     */
+    explicit IncrementalTopologicalOrder(size_t vertices = 0);
+
+    /**
+     * @brief Computes the initial order of a directed acyclic graph.
+     * @param graph The input graph.
+     * @throws std::runtime_error if the graph contains a cycle.
+     */
+    explicit IncrementalTopologicalOrder(const Graph& graph);
+
+    /**
+     * @brief Computes the initial order of a frozen directed acyclic graph.
+     * @param graph The input graph.
+     * @throws std::runtime_error if the graph contains a cycle.
+     */
+    explicit IncrementalTopologicalOrder(const CsrGraph& graph);
+
+    /**
+     * @brief Gets the number of vertices.
+     * @return Number of vertices.
+     */
+    size_t getNumVertices() const;
+
+    /**
+     * @brief Gets the vertices in topological order.
+     * @return Every vertex once; each edge leads from an earlier to a later vertex.
+     */
+    const std::vector<int>& order() const;
+
+    /**
+     * @brief Gets the index of a vertex in the current order.
+     * @param vertex Vertex to query.
+     * @return Its position in order().
+     * @throws std::out_of_range if vertex is out of range.
+     */
+    size_t getPosition(size_t vertex) const;
+
+    /**
+     * @brief Checks if an edge is present.
+     * @param from Source vertex.
+     * @param to Destination vertex.
+     * @return True if the edge was inserted and not removed.
+     * @throws std::out_of_range if either vertex is out of range.
+     */
+    bool hasEdge(size_t from, size_t to) const;
+
+    /**
+     * @brief Gets the number of vertices moved by the last successful insertion.
+     * @return Size of the reordered region, 0 if the edge already pointed forward.
+     */
+    size_t getLastReorderSize() const;
+
+    /**
+     * @brief Adds a vertex with no edges at the end of the order.
+     */
+    void addVertex();
+
+    /**
+     * @brief Inserts an edge unless it would create a cycle, updating the order.
+     * @param from Source vertex.
+     * @param to Destination vertex.
+     * @return True if the edge is present afterwards; false if it was rejected because to already
+     * reaches from (including from == to), in which case nothing changes.
+     * @throws std::out_of_range if either vertex is out of range.
+     */
+    bool addEdge(size_t from, size_t to);
+
+    /**
+     * @brief Removes an edge, if present. The current order stays valid.
+     * @param from Source vertex.
+     * @param to Destination vertex.
+     * @throws std::out_of_range if either vertex is out of range.
+     */
+    void removeEdge(size_t from, size_t to);
+};
+
+#endif // GRAPH_TOOLKIT_INCREMENTAL_TOPOLOGICAL_ORDER_H
@@ -0,0 +1,118 @@
+#ifndef GRAPH_TOOLKIT_LANDMARK_INDEX_H
+#define GRAPH_TOOLKIT_LANDMARK_INDEX_H
+
+#include "Algorithms.h"
+#include "CsrGraph.h"
+#include "Graph.h"
+#include <iosfwd>
+#include <vector>
+
+/**
+ * @brief Strategy used to pick landmarks when building a LandmarkIndex.
+ */
+enum class LandmarkSelection {
+    FarthestPoint, ///< Repeatedly pick the vertex farthest from all chosen landmarks.
+    Avoid ///< Goldberg-Harrelson "avoid": pick leaves of poorly covered shortest-path subtrees.
+};
+
+/**
+ * @brief Precomputed landmark distance tables giving ALT lower bounds for A* queries.
+ *
+ * For every landmark L the index stores dist(L, v) and dist(v, L) for all vertices v, so the
+ * triangle inequality bounds dist(u, v) from below by max(dist(L, v) - dist(L, u),
+ * dist(u, L) - dist(v, L)). Tables can be saved to and loaded from a binary stream so that the
+ * preprocessing does not have to be repeated at startup.
+ */
+class LandmarkIndex {
+private:
+    size_t numVertices;
+    std::vector<int> landmarks;
+    std::vector<std::vector<int>> fromLandmark; // fromLandmark[i][v] = dist(landmarks[i], v)
+    std::vector<std::vector<int>> toLandmark; // toLandmark[i][v] = dist(v, landmarks[i])
+
+    /**
+     * @brief Computes the missing distance tables, one dijkstra run per table, in parallel.
+     * @param graph The indexed graph.
+     * @param numThreads Number of worker threads, 0 for one per hardware thread.
+     */
+    void computeTables(const CsrGraph& graph, size_t numThreads);
+
+public:
+    /**
+     * @brief Default constructor, creates an empty index with no landmarks.
+     */
+    LandmarkIndex();
+
+    /**
+     * @brief Builds an index over explicitly chosen landmarks.
+     * @param graph The input graph (must have non-negative weights).
+     * @param landmarks Landmark vertices.
+     * @param numThreads Number of worker threads, 0 for one per hardware thread.
+     * @throws std::out_of_range if a landmark is out of range.
+     * @throws std::invalid_argument if the graph has negative weights.
+     */
+    LandmarkIndex(const Graph& graph, const std::vector<int>& landmarks, size_t numThreads = 0);
+
+    /**
+     * @brief Selects landmarks with the given strategy and builds their distance tables.
+     * @param graph The input graph (must have non-negative weights).
+     * @param numLandmarks Number of landmarks to select (capped at the number of vertices).
+     * @param selection Landmark selection strategy.
+     * @param numThreads Number of worker threads, 0 for one per hardware thread.
+     * @throws std::invalid_argument if the graph has negative weights.
+     *
+     * @note Selection is inherently sequential; the reverse tables are computed in parallel.
+     */
+    LandmarkIndex(const Graph& graph, size_t numLandmarks,
+        LandmarkSelection selection = LandmarkSelection::FarthestPoint, size_t numThreads = 0);
+
+    /**
+     * @brief Gets the number of vertices the index was built for.
+     * @return Number of vertices.
+     */
+    size_t getNumVertices() const;
+
+    /**
+     * @brief Gets the selected landmark vertices.
+     * @return Vector of landmark indices.
+     */
+    const std::vector<int>& getLandmarks() const;
+
+    /**
+     * @brief Computes a lower bound on the shortest-path distance between two vertices.
+     * @param from Source vertex.
+     * @param to Destination vertex.
+     * @return A value no greater than dist(from, to), or 0 if no landmark gives a bound.
+     * @throws std::out_of_range if either vertex is out of range.
+     */
+    int lowerBound(size_t from, size_t to) const;
+
+    /**
+     * @brief Builds a consistent A* heuristic towards a target vertex.
+     * @param target The target vertex of the search.
+     * @return A heuristic returning lowerBound(v, target).
+     * @throws std::out_of_range if target is out of range.
+     *
+     * @note The heuristic refers to this index, which must outlive it.
+     */
+    Heuristic heuristic(size_t target) const;
+
+    /**
+     * @brief Writes the index to a binary stream.
+     * @param out Output stream, opened in binary mode.
+     * @throws std::runtime_error if writing fails.
+     *
+     * @note The format uses the host byte order.
+     */
+    void save(std::ostream& out) const;
+
+    /**
+     * @brief Reads an index previously written by save.
+     * @param in Input stream, opened in binary mode.
+     * @return The loaded index.
+     * @throws std::runtime_error if the stream is truncated or not a landmark index.
+     */
+    static LandmarkIndex load(std::istream& in);
+};
+
+#endif // GRAPH_TOOLKIT_LANDMARK_INDEX_H
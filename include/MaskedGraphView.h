@@ -0,0 +1,83 @@
+#ifndef GRAPH_TOOLKIT_MASKED_GRAPH_VIEW_H
+#define GRAPH_TOOLKIT_MASKED_GRAPH_VIEW_H
+
+#include "CsrGraph.h"
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief A CsrGraph with some edges and vertices temporarily hidden, without copying the graph.
+ *
+ * Hidden entries are stamped with the current generation, so showAll() restores the full graph in
+ * O(1). Searches on the view skip hidden edges and never enter hidden vertices. The view refers to
+ * its graph, which must outlive it; one view must not be modified during a concurrent search.
+ */
+class MaskedGraphView {
+private:
+    const CsrGraph* graph;
+    std::vector<std::uint32_t> hiddenEdgeStamp;
+    std::vector<std::uint32_t> hiddenVertexStamp;
+    std::uint32_t generation;
+
+public:
+    /**
+     * @brief Creates a view of a graph with nothing hidden.
+     * @param graph The underlying graph.
+     */
+    explicit MaskedGraphView(const CsrGraph& graph);
+
+    /**
+     * @brief Gets the underlying graph.
+     * @return The graph the view refers to.
+     */
+    const CsrGraph& getGraph() const;
+
+    /**
+     * @brief Hides one edge.
+     * @param edge Edge id in the underlying graph.
+     * @throws std::out_of_range if edge is out of range.
+     */
+    void hideEdge(size_t edge);
+
+    /**
+     * @brief Hides every edge from one vertex to another.
+     * @param from Source vertex.
+     * @param to Target vertex.
+     * @throws std::out_of_range if either vertex is out of range.
+     */
+    void hideEdges(size_t from, size_t to);
+
+    /**
+     * @brief Hides a vertex and, implicitly, every edge into it.
+     * @param vertex Vertex to hide.
+     * @throws std::out_of_range if vertex is out of range.
+     */
+    void hideVertex(size_t vertex);
+
+    /**
+     * @brief Makes every edge and vertex visible again.
+     */
+    void showAll();
+
+    /**
+     * @brief Checks if an edge is hidden. Unchecked, for use in search loops.
+     * @param edge Edge id in the underlying graph.
+     * @return true if the edge is hidden.
+     */
+    bool isEdgeHidden(size_t edge) const noexcept
+    {
+        return hiddenEdgeStamp[edge] == generation;
+    }
+
+    /**
+     * @brief Checks if a vertex is hidden. Unchecked, for use in search loops.
+     * @param vertex Vertex index.
+     * @return true if the vertex is hidden.
+     */
+    bool isVertexHidden(size_t vertex) const noexcept
+    {
+        return hiddenVertexStamp[vertex] == generation;
+    }
+};
+
+#endif // GRAPH_TOOLKIT_MASKED_GRAPH_VIEW_H
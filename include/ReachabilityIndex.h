@@ -0,0 +1,129 @@
+#ifndef GRAPH_TOOLKIT_REACHABILITY_INDEX_H
+#define GRAPH_TOOLKIT_REACHABILITY_INDEX_H
+
+#include "CsrGraph.h"
+#include "Graph.h"
+#include <cstdint>
+#include <iosfwd>
+#include <vector>
+
+/**
+ * @brief Precomputed transitive closure answering "can u reach v" in constant time.
+ *
+ * The graph is condensed into its strongly connected components, numbered in topological order so
+ * that every edge between components goes from a lower to a higher number. Each component then
+ * gets a bitset of the components it reaches, filled in reverse topological order by OR-ing the
+ * bitsets of its successors. A query is a component lookup and a single bit test. The closure
+ * takes C * C / 8 bytes for C components, which suits dependency graphs with up to a few hundred
+ * thousand components; the index can be saved to and loaded from a binary stream.
+ */
+class ReachabilityIndex {
+private:
+    size_t numVertices;
+    size_t numComponents;
+    size_t rowWords; // 64-bit words per closure row
+    std::vector<int> component; // component[v] = topological number of v's component
+    std::vector<int> componentSize;
+    std::vector<std::uint64_t> closure; // row c, bit d: component c reaches component d
+
+    /**
+     * @brief Numbers the strongly connected components with an iterative Tarjan search.
+     * @param graph The indexed graph.
+     */
+    void condense(const CsrGraph& graph);
+
+    /**
+     * @brief Fills the closure rows from the last component to the first.
+     * @param graph The indexed graph.
+     */
+    void computeClosure(const CsrGraph& graph);
+
+public:
+    /**
+     * @brief Default constructor, creates an empty index over no vertices.
+     */
+    ReachabilityIndex();
+
+    /**
+     * @brief Builds the index for a frozen graph.
+     * @param graph The input graph.
+     */
+    explicit ReachabilityIndex(const CsrGraph& graph);
+
+    /**
+     * @brief Builds the index for a graph.
+     * @param graph The input graph.
+     */
+    explicit ReachabilityIndex(const Graph& graph);
+
+    /**
+     * @brief Gets the number of vertices the index was built for.
+     * @return Number of vertices.
+     */
+    size_t getNumVertices() const;
+
+    /**
+     * @brief Gets the number of strongly connected components.
+     * @return Number of components.
+     */
+    size_t getNumComponents() const;
+
+    /**
+     * @brief Gets the strongly connected component of a vertex.
+     * @param vertex The vertex.
+     * @return Component number; components are numbered in topological order.
+     * @throws std::out_of_range if vertex is out of range.
+     */
+    int getComponent(size_t vertex) const;
+
+    /**
+     * @brief Checks whether a path leads from one vertex to another.
+     * @param from Source vertex.
+     * @param to Destination vertex.
+     * @return True if to is reachable from from; every vertex reaches itself.
+     * @throws std::out_of_range if either vertex is out of range.
+     */
+    bool canReach(size_t from, size_t to) const;
+
+    /**
+     * @brief Checks if two vertices are strongly connected.
+     * @param u The first vertex.
+     * @param v The second vertex.
+     * @return True if u and v lie in the same strongly connected component.
+     * @throws std::out_of_range if either vertex is out of range.
+     */
+    bool areStronglyConnected(size_t u, size_t v) const;
+
+    /**
+     * @brief Counts the vertices reachable from a vertex, including itself.
+     * @param from Source vertex.
+     * @return Number of reachable vertices.
+     * @throws std::out_of_range if from is out of range.
+     */
+    size_t countReachable(size_t from) const;
+
+    /**
+     * @brief Gets the number of bytes used by the index's arrays.
+     * @return Memory usage in bytes.
+     */
+    size_t getMemoryUsage() const;
+
+    /**
+     * @brief Writes the index to a binary stream.
+     * @param out Output stream, opened in binary mode.
+     * @throws std::runtime_error if writing fails.
+     *
+     * @note The format uses the host byte order.
+     */
+    void save(std::ostream& out) const;
+
+    /**
+     * @brief Reads an index previously written by save.
+     * @param in Input stream, opened in binary mode.
+     * @return The loaded index.
+     * @throws std::runtime_error if the stream is truncated or not a reachability index.
+     */
+    static ReachabilityIndex load(std::istream& in);
+};
+
+#endif // GRAPH_TOOLKIT_REACHABILITY_INDEX_H
@@ -0,0 +1,296 @@
+#ifndef GRAPH_TOOLKIT_SHORTEST_PATH_TREE_H
+#define GRAPH_TOOLKIT_SHORTEST_PATH_TREE_H
+
+#include "Algorithms.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <mutex>
+#include <span>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Shortest-path tree built from the {distances, predecessors} result of a search.
+ *
+ * The tree itself is only the distances and a parent array of 32-bit vertex ids. Paths and depths
+ * are walked from a target up to the source without allocating, or copied into a caller-owned
+ * buffer in source-to-target order. The first ancestor or subtree query lays the vertices out in
+ * preorder, so each subtree is one contiguous slice and later ancestor tests are O(1); trees that
+ * only answer path queries never pay for that layout.
+ *
+ * @tparam Distance Type of the distances the tree was built from.
+ */
+template <DistanceType Distance> class BasicShortestPathTree {
+private:
+    std::int32_t source;
+    std::vector<Distance> dist;
+    std::vector<std::int32_t> parent;
+    mutable std::vector<std::int32_t> preorder; // built on the first subtree query
+    mutable std::vector<std::int32_t> preorderIndex;
+    mutable std::vector<std::int32_t> subtreeSize;
+    mutable std::atomic<bool> layoutBuilt;
+    mutable std::mutex layoutMutex;
+
+    /**
+     * @brief Checks if a vertex index is valid for this tree.
+     * @param vertex Vertex index to check.
+     * @return true if vertex is within valid range, false otherwise.
+     */
+    bool validVertex(size_t vertex) const noexcept;
+
+    /**
+     * @brief Copies the predecessors into the parent array, checking that they form a tree.
+     * @param predecessors Predecessor of every vertex, -1 for the source and unreached vertices.
+     */
+    void build(const std::vector<int>& predecessors);
+
+    /**
+     * @brief Builds the preorder layout used by subtree queries, once; safe to call concurrently.
+     */
+    void buildLayout() const;
+
+    /**
+     * @brief Counts the edges from the source to a reachable vertex by walking its parents.
+     * @param vertex A reachable vertex.
+     * @return The number of edges.
+     */
+    int walkDepth(size_t vertex) const noexcept;
+
+public:
+    /**
+     * @brief Forward iterator over the vertices of a path, from its target up to the source.
+     */
+    class PathIterator {
+    private:
+        const std::int32_t* parent;
+        std::int32_t vertex;
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = int;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = int;
+
+        PathIterator()
+            : parent(nullptr)
+            , vertex(-1)
+        {
+        }
+
+        PathIterator(const std::int32_t* parent, std::int32_t vertex)
+            : parent(parent)
+            , vertex(vertex)
+        {
+        }
+
+        int operator*() const { return vertex; }
+
+        PathIterator& operator++()
+        {
+            vertex = parent[vertex];
+            return *this;
+        }
+
+        PathIterator operator++(int)
+        {
+            PathIterator previous = *this;
+            ++*this;
+            return previous;
+        }
+
+        bool operator==(const PathIterator& other) const { return vertex == other.vertex; }
+    };
+
+    /**
+     * @brief Lazy view of a tree path, iterated from its target up to the source.
+     */
+    class PathView {
+    private:
+        PathIterator first;
+        size_t length;
+
+    public:
+        PathView(PathIterator first, size_t length)
+            : first(first)
+            , length(length)
+        {
+        }
+
+        PathIterator begin() const { return first; }
+        PathIterator end() const { return {}; }
+
+        /**
+         * @brief Gets the number of vertices on the path.
+         * @return Number of vertices, 0 if the target is unreachable.
+         */
+        size_t size() const { return length; }
+
+        bool empty() const { return length == 0; }
+    };
+
+    /**
+     * @brief Builds the tree from separate distance and predecessor vectors.
+     * @param distances Distance to every vertex, unreachableDistance() where unreachable.
+     * @param predecessors Predecessor of every vertex, -1 for the source and unreached vertices.
+     * @param source The source vertex of the search.
+     * @throws std::out_of_range if source is out of range.
+     * @throws std::invalid_argument if the vectors differ in size or the predecessors do not form
+     * a tree rooted at source.
+     * @throws std::overflow_error if the graph has too many vertices for 32-bit ids.
+     */
+    BasicShortestPathTree(
+        std::vector<Distance> distances, const std::vector<int>& predecessors, size_t source);
+
+    /**
+     * @brief Builds the tree from the result of dijkstra or bellmanFord.
+     * @param result A pair of {distances, predecessors}.
+     * @param source The source vertex of the search.
+     * @throws std::out_of_range if source is out of range.
+     * @throws std::invalid_argument if the predecessors do not form a tree rooted at source.
+     */
+    BasicShortestPathTree(
+        const std::pair<std::vector<Distance>, std::vector<int>>& result, size_t source);
+
+    /**
+     * @brief Builds the tree from the last search of a workspace.
+     * @param workspace Workspace holding a full (not early-terminated) search from source.
+     * @param source The source vertex of that search.
+     * @throws std::out_of_range if source is out of range.
+     */
+    BasicShortestPathTree(const BasicShortestPathWorkspace<Distance>& workspace, size_t source);
+
+    /**
+     * @brief Copy constructor.
+     * @param other Tree to copy.
+     */
+    BasicShortestPathTree(const BasicShortestPathTree& other);
+
+    /**
+     * @brief Copy assignment operator.
+     * @param other Tree to copy.
+     * @return Reference to this tree.
+     */
+    BasicShortestPathTree& operator=(const BasicShortestPathTree& other);
+
+    /**
+     * @brief Move constructor.
+     * @param other Tree to move from.
+     */
+    BasicShortestPathTree(BasicShortestPathTree&& other) noexcept;
+
+    /**
+     * @brief Move assignment operator.
+     * @param other Tree to move from.
+     * @return Reference to this tree.
+     */
+    BasicShortestPathTree& operator=(BasicShortestPathTree&& other) noexcept;
+
+    /**
+     * @brief Destructor.
+     */
+    ~BasicShortestPathTree() = default;
+
+    /**
+     * @brief Gets the number of vertices.
+     * @return Number of vertices.
+     */
+    size_t getNumVertices() const;
+
+    /**
+     * @brief Gets the source vertex.
+     * @return The source vertex.
+     */
+    size_t getSource() const;
+
+    /**
+     * @brief Checks if a vertex is reachable from the source.
+     * @param vertex Vertex to query.
+     * @return true if vertex is in the tree.
+     * @throws std::out_of_range if vertex is out of range.
+     */
+    bool isReachable(size_t vertex) const;
+
+    /**
+     * @brief Gets the distance of a vertex.
+     * @param vertex Vertex to query.
+     * @return The distance, or unreachableDistance() if vertex is unreachable.
+     * @throws std::out_of_range if vertex is out of range.
+     */
+    Distance getDistance(size_t vertex) const;
+
+    /**
+     * @brief Gets the parent of a vertex.
+     * @param vertex Vertex to query.
+     * @return The parent, or -1 for the source and unreachable vertices.
+     * @throws std::out_of_range if vertex is out of range.
+     */
+    int getParent(size_t vertex) const;
+
+    /**
+     * @brief Gets the number of edges on the path from the source to a vertex.
+     * @param vertex Vertex to query.
+     * @return The number of edges, or -1 if vertex is unreachable.
+     * @throws std::out_of_range if vertex is out of range.
+     *
+     * @note O(depth), walking the parent array.
+     */
+    int getDepth(size_t vertex) const;
+
+    /**
+     * @brief Gets the path to a vertex as a lazy view, from the vertex up to the source.
+     * @param target Last vertex of the path.
+     * @return View over the path's vertices in reverse order, empty if target is unreachable.
+     * @throws std::out_of_range if target is out of range.
+     *
+     * @note O(path length) to create, which counts the vertices, and to iterate, without
+     * allocating.
+     */
+    PathView path(size_t target) const;
+
+    /**
+     * @brief Copies the path to a vertex into a buffer, from the source to the vertex.
+     * @param target Last vertex of the path.
+     * @param out Buffer resized to the path's length and overwritten; emptied if target is
+     * unreachable. Reusing it across calls avoids allocation once it has grown.
+     * @throws std::out_of_range if target is out of range.
+     */
+    void copyPath(size_t target, std::vector<int>& out) const;
+
+    /**
+     * @brief Checks if one vertex lies on the path from the source to another.
+     * @param ancestor Candidate ancestor.
+     * @param vertex Candidate descendant; every reachable vertex is its own ancestor.
+     * @return true if both are reachable and ancestor is on the path to vertex.
+     * @throws std::out_of_range if either vertex is out of range.
+     *
+     * @note O(1) once the preorder layout exists; the first subtree query builds it in O(V).
+     */
+    bool isAncestor(size_t ancestor, size_t vertex) const;
+
+    /**
+     * @brief Gets the vertices of the subtree rooted at a vertex, in preorder.
+     * @param root Root of the subtree.
+     * @return View of the subtree's vertices starting with root, empty if root is unreachable.
+     * @throws std::out_of_range if root is out of range.
+     *
+     * @note The first subtree query builds the preorder layout in O(V).
+     */
+    std::span<const std::int32_t> subtree(size_t root) const;
+
+    /**
+     * @brief Gets the number of bytes used by the tree's arrays, including the preorder layout
+     * once a subtree query has built it.
+     * @return Memory usage in bytes.
+     */
+    size_t getMemoryUsage() const;
+};
+
+/**
+ * @brief Shortest-path tree over int distances.
+ */
+using ShortestPathTree = BasicShortestPathTree<int>;
+
+#endif // GRAPH_TOOLKIT_SHORTEST_PATH_TREE_H
@@ -0,0 +1,101 @@
+#ifndef GRAPH_TOOLKIT_TRAVERSAL_H
+#define GRAPH_TOOLKIT_TRAVERSAL_H
+
+#include "CsrGraph.h"
+#include "Graph.h"
+#include <vector>
+
+/**
+ * @brief Result of a breadth-first search from one source.
+ */
+struct BreadthFirstResult {
+    std::vector<int> levels; ///< Number of edges from the source, -1 if unreached.
+    std::vector<int> parents; ///< BFS tree parent, -1 for the source and unreached vertices.
+    std::vector<int> order; ///< Reached vertices, level by level starting with the source.
+};
+
+/**
+ * @brief Runs a direction-optimizing breadth-first search on a frozen graph.
+ * @param graph The input graph.
+ * @param reverse The transpose of graph, used to scan in-edges bottom-up.
+ * @param source The source vertex.
+ * @param alpha Switch to bottom-up once the frontier's out-edges exceed 1/alpha of the edges
+ * leaving unvisited vertices.
+ * @param beta Switch back to top-down once a shrinking frontier holds fewer than 1/beta of the
+ * vertices.
+ * @return The levels, parents and visit order of every vertex.
+ * @throws std::out_of_range if source is out of range.
+ * @throws std::invalid_argument if reverse has a different vertex count or alpha or beta is 0.
+ *
+ * @note Small frontiers expand top-down over out-edges. Large frontiers are stored as a bitmap and
+ * every unvisited vertex scans its in-edges for a frontier parent instead, stopping at the first
+ * hit, which skips most edges on low-diameter graphs. Levels match a queue-based BFS; within a
+ * level, bottom-up steps list vertices by index and may pick different (equally short) parents.
+ */
+BreadthFirstResult directionOptimizingBfs(const CsrGraph& graph, const CsrGraph& reverse,
+    size_t source, size_t alpha = 15, size_t beta = 18);
+
+/**
+ * @brief Runs a direction-optimizing breadth-first search on a frozen graph.
+ * @param graph The input graph.
+ * @param source The source vertex.
+ * @return The levels, parents and visit order of every vertex.
+ * @throws std::out_of_range if source is out of range.
+ *
+ * @note Builds the reverse index with graph.transpose(); pass it explicitly for repeated searches.
+ */
+BreadthFirstResult directionOptimizingBfs(const CsrGraph& graph, size_t source);
+
+/**
+ * @brief Runs a direction-optimizing breadth-first search.
+ * @param graph The input graph.
+ * @param source The source vertex.
+ * @return The levels, parents and visit order of every vertex.
+ * @throws std::out_of_range if source is out of range.
+ */
+BreadthFirstResult directionOptimizingBfs(const Graph& graph, size_t source);
+
+/**
+ * @brief Runs a level-synchronous breadth-first search on several threads.
+ * @param graph The input graph.
+ * @param source The source vertex.
+ * @param numThreads Number of worker threads, 0 for one per hardware thread.
+ * @return The levels, parents and visit order of every vertex.
+ * @throws std::out_of_range if source is out of range.
+ *
+ * @note Workers take chunks of the current frontier and claim unvisited neighbors with an atomic
+ * fetch-or on a shared visited bitmap, so each vertex is discovered exactly once. Discoveries go
+ * to per-thread buffers that are concatenated into the order at the end of the level, each worker
+ * copying its own buffer at a precomputed offset, so no locks are taken. Levels match a
+ * queue-based BFS; the order within a level and the choice among equally short parents depend on
+ * scheduling.
+ */
+BreadthFirstResult parallelBfs(const CsrGraph& graph, size_t source, size_t numThreads = 0);
+
+/**
+ * @brief Computes hop counts from many sources with multi-source bit-parallel BFS (MS-BFS).
+ * @param graph The input graph.
+ * @param sources Source vertices; duplicates are allowed.
+ * @param numThreads Number of worker threads, 0 for one per hardware thread.
+ * @return One vector per source with the number of edges to every vertex, -1 where unreachable.
+ * @throws std::out_of_range if a source vertex is out of range.
+ *
+ * @note Sources are processed in batches of 64, one bit per source in a 64-bit word per vertex.
+ * Each level scans the neighbors of a vertex once for every source whose frontier contains it,
+ * so a batch costs about as much memory traffic as a single BFS. Batches run in parallel.
+ */
+std::vector<std::vector<int>> multiSourceBfs(
+    const CsrGraph& graph, const std::vector<int>& sources, size_t numThreads = 0);
+
+/**
+ * @brief Computes hop counts from many sources with multi-source bit-parallel BFS (MS-BFS).
+ * @param graph The input graph.
+ * @param sources Source vertices; duplicates are allowed.
+ * @param numThreads Number of worker threads, 0 for one per hardware thread.
+ * @return One vector per source with the number of edges to every vertex, -1 where unreachable.
+ * @throws std::out_of_range if a source vertex is out of range.
+ */
+std::vector<std::vector<int>> multiSourceBfs(
+    const Graph& graph, const std::vector<int>& sources, size_t numThreads = 0);
+
+#endif // GRAPH_TOOLKIT_TRAVERSAL_H
@@ -0,0 +1,93 @@
+#ifndef GRAPH_TOOLKIT_UNION_FIND_H
+#define GRAPH_TOOLKIT_UNION_FIND_H
+
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+/**
+ * @brief Lock-free disjoint-set forest over the elements 0 .. size - 1.
+ *
+ * Parents are atomics. unite links the larger root below the smaller one with a compare-and-swap
+ * and retries if another thread relinked either root first. find compresses paths by halving,
+ * each step a compare-and-swap that may harmlessly fail. find, unite and connected may therefore
+ * run concurrently from any number of threads, and const queries still shorten paths for later
+ * ones. Growing or resetting the forest is not thread-safe.
+ */
+class ConcurrentUnionFind {
+private:
+    mutable std::vector<std::atomic<int>> parent;
+    std::atomic<size_t> numSets;
+
+public:
+    /**
+     * @brief Default constructor, creates an empty forest.
+     */
+    ConcurrentUnionFind();
+
+    /**
+     * @brief Creates a forest of singleton sets.
+     * @param size Number of elements.
+     */
+    explicit ConcurrentUnionFind(size_t size);
+
+    ConcurrentUnionFind(const ConcurrentUnionFind& other);
+    ConcurrentUnionFind& operator=(const ConcurrentUnionFind& other);
+    ConcurrentUnionFind(ConcurrentUnionFind&& other) noexcept;
+    ConcurrentUnionFind& operator=(ConcurrentUnionFind&& other) noexcept;
+
+    /**
+     * @brief Gets the number of elements.
+     * @return Number of elements.
+     */
+    size_t getSize() const;
+
+    /**
+     * @brief Gets the number of disjoint sets.
+     * @return Number of sets.
+     */
+    size_t getNumSets() const;
+
+    /**
+     * @brief Finds the representative of an element's set.
+     * @param element The element.
+     * @return The root of its tree, the smallest element of the set.
+     * @throws std::out_of_range if element is out of range.
+     */
+    int find(size_t element) const;
+
+    /**
+     * @brief Merges the sets of two elements.
+     * @param a The first element.
+     * @param b The second element.
+     * @return True if the sets were different and have been merged.
+     * @throws std::out_of_range if either element is out of range.
+     */
+    bool unite(size_t a, size_t b);
+
+    /**
+     * @brief Checks whether two elements are in the same set.
+     * @param a The first element.
+     * @param b The second element.
+     * @return True if both elements share a set.
+     * @throws std::out_of_range if either element is out of range.
+     */
+    bool connected(size_t a, size_t b) const;
+
+    /**
+     * @brief Appends a new singleton element.
+     *
+     * @note Reallocates the forest in O(size); not thread-safe.
+     */
+    void addElement();
+
+    /**
+     * @brief Replaces the forest with singleton sets.
+     * @param size New number of elements.
+     *
+     * @note Not thread-safe.
+     */
+    void reset(size_t size);
+};
+
+#endif // GRAPH_TOOLKIT_UNION_FIND_H
@@ -1,139 +1,931 @@
 #include "Algorithms.h"
+#include "Parallel.h"
+#include "PathLength.h"
+#include <algorithm>
+#include <atomic>
+#include <barrier>
+#include <cmath>
+#include <exception>
 #include <limits>
 #include <queue>
+#include <set>
 #include <stdexcept>
 #include <vector>
 
-std::pair<std::vector<int>, std::vector<int>> dijkstra(const Graph& graph, size_t source)
+namespace {
+
+const int INF = std::numeric_limits<int>::max();
+
+// Levels at least this large are expanded by all workers; smaller ones by a single thread.
+const size_t PARALLEL_LEVEL_SIZE = 4096;
+
+// Vertices of a level handed to a worker at a time.
+const size_t LEVEL_CHUNK = 256;
+
+// Edge filter of unmasked searches.
+const auto allowAll = [](size_t, size_t) { return true; };
+
+/**
+ * Follows the predecessors of the last search back from target to source.
+ */
+std::vector<int> tracePath(const ShortestPathWorkspace& workspace, size_t source, size_t target)
 {
-    size_t n = graph.getNumVertices();
+    std::vector<int> path;
+    for (int v = static_cast<int>(target); v != static_cast<int>(source);
+         v = workspace.getPredecessor(static_cast<size_t>(v)))
+        path.push_back(v);
+    path.push_back(static_cast<int>(source));
+    std::reverse(path.begin(), path.end());
+    return path;
+}
 
-    if (source >= n)
-        throw std::out_of_range("Source vertex is out of range.");
+/**
+ * Weight of the lightest edge from one vertex to another; the edge must exist.
+ */
+int lightestEdge(const CsrGraph& graph, size_t from, size_t to)
+{
+    std::span<const int> neighbors = graph.getNeighbors(from);
+    std::span<const int> weights = graph.getWeights(from);
+    int lightest = INF;
+    for (size_t i = 0; i < neighbors.size(); ++i)
+        if (static_cast<size_t>(neighbors[i]) == to)
+            lightest = std::min(lightest, weights[i]);
+    return lightest;
+}
+
+/**
+ * Yen's algorithm. Each round deviates from the last accepted path at every vertex (the spur
+ * node): the root path before it is hidden, as are the edges leaving the spur node along any
+ * accepted path with the same root, and a Dijkstra search finishes the path to target.
+ */
+std::vector<std::pair<std::vector<int>, int>> looplessPaths(
+    const CsrGraph& graph, size_t source, size_t target, size_t k, size_t numThreads)
+{
+    std::vector<std::pair<std::vector<int>, int>> accepted;
+    size_t threads = resolveThreadCount(numThreads, graph.getNumVertices());
+    std::vector<MaskedGraphView> views(threads, MaskedGraphView(graph));
+    std::vector<ShortestPathWorkspace> workspaces(threads);
+
+    dijkstra(views[0], source, target, workspaces[0]);
+    if (workspaces[0].getDistance(target) == INF)
+        return accepted;
+    accepted.push_back(
+        { tracePath(workspaces[0], source, target), workspaces[0].getDistance(target) });
+
+    // Candidates ordered by length, then vertex sequence, which also removes duplicates.
+    std::set<std::pair<int, std::vector<int>>> candidates;
+    while (accepted.size() < k) {
+        const std::vector<int>& previous = accepted.back().first;
+        std::vector<int> rootLength(previous.size(), 0);
+        for (size_t i = 1; i < previous.size(); ++i)
+            rootLength[i] = extend(rootLength[i - 1],
+                lightestEdge(graph, static_cast<size_t>(previous[i - 1]),
+                    static_cast<size_t>(previous[i])));
 
-    // Check for negative weights.
+        // Spur searches only read the accepted paths, so they run in parallel.
+        std::vector<std::pair<std::vector<int>, int>> spurs(previous.size() - 1);
+        parallelFor(spurs.size(), threads, [&](size_t worker, size_t i) {
+            MaskedGraphView& view = views[worker];
+            ShortestPathWorkspace& workspace = workspaces[worker];
+            size_t spurNode = static_cast<size_t>(previous[i]);
+
+            view.showAll();
+            for (size_t j = 0; j < i; ++j)
+                view.hideVertex(static_cast<size_t>(previous[j]));
+            for (const auto& [path, length] : accepted)
+                if (path.size() > i + 1
+                    && std::equal(previous.begin(), previous.begin() + i + 1, path.begin()))
+                    view.hideEdges(spurNode, static_cast<size_t>(path[i + 1]));
+
+            dijkstra(view, spurNode, target, workspace);
+            if (workspace.getDistance(target) == INF)
+                return;
+
+            std::vector<int> path(previous.begin(), previous.begin() + i);
+            std::vector<int> spur = tracePath(workspace, spurNode, target);
+            path.insert(path.end(), spur.begin(), spur.end());
+            spurs[i] = { std::move(path), extend(rootLength[i], workspace.getDistance(target)) };
+        });
+
+        for (auto& [path, length] : spurs)
+            if (!path.empty())
+                candidates.insert({ length, std::move(path) });
+        if (candidates.empty())
+            break;
+
+        accepted.push_back({ candidates.begin()->second, candidates.begin()->first });
+        candidates.erase(candidates.begin());
+    }
+
+    return accepted;
+}
+
+/**
+ * Eppstein-style enumeration of paths that may repeat vertices. Every path is the shortest-path
+ * tree into target plus a sequence of sidetracks (non-tree edges), each costing
+ * w(u, v) + d(v) - d(u) extra. A path's children append one sidetrack leaving the tree route from
+ * the head of its last sidetrack, which generates every path exactly once.
+ */
+std::vector<std::pair<std::vector<int>, int>> walkPaths(
+    const CsrGraph& graph, size_t source, size_t target, size_t k)
+{
+    std::vector<std::pair<std::vector<int>, int>> paths;
+    ShortestPathWorkspace tree;
+    dijkstra(graph.transpose(), target, tree);
+    if (tree.getDistance(source) == INF || k == 0)
+        return paths;
+
+    // The tree edge of u is its first edge to the next vertex towards target that is tight.
+    size_t n = graph.getNumVertices();
+    const size_t NONE = std::numeric_limits<size_t>::max();
+    std::vector<size_t> treeEdge(n, NONE);
     for (size_t u = 0; u < n; ++u) {
-        std::vector<int> neighbors = graph.getNeighbors(u);
-        for (int v : neighbors) {
-            if (graph.getEdgeWeight(u, static_cast<size_t>(v)) < 0)
-                throw std::invalid_argument("Graph contains negative edge weights.");
+        int next = tree.getPredecessor(u);
+        if (next == -1)
+            continue;
+        std::span<const int> neighbors = graph.getNeighbors(u);
+        std::span<const int> weights = graph.getWeights(u);
+        for (size_t i = 0; i < neighbors.size() && treeEdge[u] == NONE; ++i)
+            if (neighbors[i] == next
+                && extend(tree.getDistance(static_cast<size_t>(next)), weights[i])
+                    == tree.getDistance(u))
+                treeEdge[u] = graph.edgeBegin(u) + i;
+    }
+
+    struct Sidetrack {
+        size_t parent; // NONE for the shortest path itself
+        size_t tail;
+        size_t head;
+    };
+    std::vector<Sidetrack> nodes = { { NONE, NONE, source } };
+    std::priority_queue<std::pair<int, size_t>, std::vector<std::pair<int, size_t>>,
+        std::greater<>>
+        queue;
+    queue.push({ tree.getDistance(source), 0 });
+
+    while (!queue.empty() && paths.size() < k) {
+        auto [length, index] = queue.top();
+        queue.pop();
+
+        std::vector<const Sidetrack*> chain;
+        for (size_t i = index; nodes[i].parent != NONE; i = nodes[i].parent)
+            chain.push_back(&nodes[i]);
+
+        std::vector<int> path = { static_cast<int>(source) };
+        size_t current = source;
+        auto followTreeTo = [&](size_t stop) {
+            while (current != stop) {
+                current = static_cast<size_t>(tree.getPredecessor(current));
+                path.push_back(static_cast<int>(current));
+            }
+        };
+        for (size_t i = chain.size(); i-- > 0;) {
+            followTreeTo(chain[i]->tail);
+            current = chain[i]->head;
+            path.push_back(static_cast<int>(current));
+        }
+        followTreeTo(target);
+        paths.push_back({ std::move(path), length });
+
+        for (size_t u = nodes[index].head;; u = static_cast<size_t>(tree.getPredecessor(u))) {
+            std::span<const int> neighbors = graph.getNeighbors(u);
+            std::span<const int> weights = graph.getWeights(u);
+            for (size_t i = 0; i < neighbors.size(); ++i) {
+                size_t v = static_cast<size_t>(neighbors[i]);
+                if (graph.edgeBegin(u) + i == treeEdge[u] || tree.getDistance(v) == INF)
+                    continue;
+                int detour = extend(tree.getDistance(v), weights[i]) - tree.getDistance(u);
+                nodes.push_back({ index, u, v });
+                queue.push({ extend(length, detour), nodes.size() - 1 });
+            }
+            if (u == target)
+                break;
         }
     }
 
-    const int INF = std::numeric_limits<int>::max();
-    std::vector<int> dist(n, INF);
-    std::vector<int> pred(n, -1);
-    dist[source] = 0;
+    return paths;
+}
+
+} // namespace
+
+template <DistanceType Distance>
+BasicShortestPathWorkspace<Distance>::BasicShortestPathWorkspace()
+    : epoch(0)
+{
+}
+
+template <DistanceType Distance>
+template <typename EdgeFilter>
+void BasicShortestPathWorkspace<Distance>::search(const CsrGraph& graph, size_t source,
+    size_t target, const Heuristic* heuristic, const EdgeFilter& allowed)
+{
+    size_t n = graph.getNumVertices();
+    if (dist.size() != n) {
+        dist.assign(n, unreachableDistance<Distance>());
+        pred.assign(n, -1);
+        reachedEpoch.assign(n, 0);
+        settledEpoch.assign(n, 0);
+        epoch = 0;
+    }
+
+    // Stamps from earlier runs become stale by bumping the epoch; only a wrap-around clears them.
+    if (++epoch == 0) {
+        std::fill(reachedEpoch.begin(), reachedEpoch.end(), 0);
+        std::fill(settledEpoch.begin(), settledEpoch.end(), 0);
+        epoch = 1;
+    }
+    settledOrder.clear();
+    heap.clear();
 
-    // Min-heap: {distance, vertex}
-    using PQEntry = std::pair<int, size_t>;
-    std::priority_queue<PQEntry, std::vector<PQEntry>, std::greater<PQEntry>> pq;
-    pq.push({ 0, source });
+    // Min-heap: {distance + heuristic, vertex}
+    auto push = [this](Distance key, size_t vertex) {
+        heap.push_back({ key, static_cast<int>(vertex) });
+        std::push_heap(heap.begin(), heap.end(), std::greater<>());
+    };
 
-    while (!pq.empty()) {
-        auto [d, u] = pq.top();
-        pq.pop();
+    dist[source] = 0;
+    pred[source] = -1;
+    reachedEpoch[source] = epoch;
+    push(heuristic ? static_cast<Distance>((*heuristic)(source)) : Distance(0), source);
+
+    while (!heap.empty()) {
+        std::pop_heap(heap.begin(), heap.end(), std::greater<>());
+        size_t u = static_cast<size_t>(heap.back().second);
+        heap.pop_back();
 
-        if (d > dist[u])
+        if (settledEpoch[u] == epoch)
             continue;
+        settledEpoch[u] = epoch;
+        settledOrder.push_back(static_cast<int>(u));
 
-        std::vector<int> neighbors = graph.getNeighbors(u);
-        for (int neighbor : neighbors) {
-            size_t v = static_cast<size_t>(neighbor);
-            int weight = graph.getEdgeWeight(u, v);
-            if (dist[u] != INF && dist[u] + weight < dist[v]) {
-                dist[v] = dist[u] + weight;
+        if (u == target)
+            return;
+
+        std::span<const int> neighbors = graph.getNeighbors(u);
+        std::span<const int> weights = graph.getWeights(u);
+        size_t firstEdge = graph.edgeBegin(u);
+        for (size_t i = 0; i < neighbors.size(); ++i) {
+            size_t v = static_cast<size_t>(neighbors[i]);
+            if (settledEpoch[v] == epoch || !allowed(firstEdge + i, v))
+                continue;
+            Distance candidate = extend(dist[u], weights[i]);
+            if (reachedEpoch[v] != epoch || candidate < dist[v]) {
+                reachedEpoch[v] = epoch;
+                dist[v] = candidate;
                 pred[v] = static_cast<int>(u);
-                pq.push({ dist[v], v });
+                push(heuristic ? extend(candidate, (*heuristic)(v)) : candidate, v);
             }
         }
     }
+}
 
-    return { dist, pred };
+template <DistanceType Distance> size_t BasicShortestPathWorkspace<Distance>::getNumVertices() const
+{
+    return dist.size();
+}
+
+template <DistanceType Distance>
+Distance BasicShortestPathWorkspace<Distance>::getDistance(size_t vertex) const
+{
+    if (vertex >= dist.size())
+        throw std::out_of_range("This index is out of range.");
+
+    return reachedEpoch[vertex] == epoch ? dist[vertex] : unreachableDistance<Distance>();
+}
+
+template <DistanceType Distance>
+int BasicShortestPathWorkspace<Distance>::getPredecessor(size_t vertex) const
+{
+    if (vertex >= pred.size())
+        throw std::out_of_range("This index is out of range.");
+
+    return reachedEpoch[vertex] == epoch ? pred[vertex] : -1;
+}
+
+template <DistanceType Distance>
+const std::vector<int>& BasicShortestPathWorkspace<Distance>::getSettled() const
+{
+    return settledOrder;
+}
+
+template <DistanceType Distance>
+std::vector<Distance> BasicShortestPathWorkspace<Distance>::distances() const
+{
+    std::vector<Distance> result(dist.size(), unreachableDistance<Distance>());
+    for (size_t v = 0; v < dist.size(); ++v)
+        if (reachedEpoch[v] == epoch)
+            result[v] = dist[v];
+    return result;
+}
+
+template <DistanceType Distance>
+std::vector<int> BasicShortestPathWorkspace<Distance>::predecessors() const
+{
+    std::vector<int> result(pred.size(), -1);
+    for (size_t v = 0; v < pred.size(); ++v)
+        if (reachedEpoch[v] == epoch)
+            result[v] = pred[v];
+    return result;
+}
+
+template <DistanceType Distance>
+std::pair<std::vector<Distance>, std::vector<int>> dijkstra(const Graph& graph, size_t source)
+{
+    if (source >= graph.getNumVertices())
+        throw std::out_of_range("Source vertex is out of range.");
+
+    BasicShortestPathWorkspace<Distance> workspace;
+    dijkstra(CsrGraph(graph), source, workspace);
+
+    return { workspace.distances(), workspace.predecessors() };
+}
+
+template <DistanceType Distance>
+void dijkstra(
+    const CsrGraph& graph, size_t source, BasicShortestPathWorkspace<Distance>& workspace)
+{
+    if (source >= graph.getNumVertices())
+        throw std::out_of_range("Source vertex is out of range.");
+    if (graph.hasNegativeWeights())
+        throw std::invalid_argument("Graph contains negative edge weights.");
+
+    workspace.search(graph, source, graph.getNumVertices(), nullptr, allowAll);
+}
+
+template <DistanceType Distance>
+void dijkstra(const MaskedGraphView& view, size_t source, size_t target,
+    BasicShortestPathWorkspace<Distance>& workspace)
+{
+    const CsrGraph& graph = view.getGraph();
+    if (source >= graph.getNumVertices())
+        throw std::out_of_range("Source vertex is out of range.");
+    if (graph.hasNegativeWeights())
+        throw std::invalid_argument("Graph contains negative edge weights.");
+
+    workspace.search(graph, source, target, nullptr, [&view](size_t edge, size_t head) {
+        return !view.isEdgeHidden(edge) && !view.isVertexHidden(head);
+    });
+}
+
+std::vector<std::vector<int>> batchDijkstra(
+    const Graph& graph, const std::vector<int>& sources, size_t numThreads)
+{
+    std::vector<std::vector<int>> matrix(sources.size());
+    batchDijkstra(
+        CsrGraph(graph), sources,
+        [&matrix](size_t i, const ShortestPathWorkspace& workspace) {
+            matrix[i] = workspace.distances();
+        },
+        numThreads);
+
+    return matrix;
+}
+
+void batchDijkstra(const CsrGraph& graph, const std::vector<int>& sources,
+    const BatchCallback& callback, size_t numThreads)
+{
+    for (int source : sources)
+        if (source < 0 || static_cast<size_t>(source) >= graph.getNumVertices())
+            throw std::out_of_range("Source vertex is out of range.");
+    if (graph.hasNegativeWeights())
+        throw std::invalid_argument("Graph contains negative edge weights.");
+
+    std::vector<ShortestPathWorkspace> workspaces(resolveThreadCount(numThreads, sources.size()));
+    parallelFor(sources.size(), numThreads, [&](size_t worker, size_t i) {
+        ShortestPathWorkspace& workspace = workspaces[worker];
+        dijkstra(graph, static_cast<size_t>(sources[i]), workspace);
+        callback(i, workspace);
+    });
+}
+
+std::pair<std::vector<int>, std::vector<int>> aStar(
+    const Graph& graph, size_t source, size_t target, const Heuristic& heuristic)
+{
+    size_t n = graph.getNumVertices();
+
+    if (source >= n || target >= n)
+        throw std::out_of_range("Source or target vertex is out of range.");
+
+    ShortestPathWorkspace workspace;
+    aStar(CsrGraph(graph), source, target, heuristic, workspace);
+
+    return { workspace.distances(), workspace.predecessors() };
+}
+
+template <DistanceType Distance>
+void aStar(const CsrGraph& graph, size_t source, size_t target, const Heuristic& heuristic,
+    BasicShortestPathWorkspace<Distance>& workspace)
+{
+    if (source >= graph.getNumVertices() || target >= graph.getNumVertices())
+        throw std::out_of_range("Source or target vertex is out of range.");
+    if (graph.hasNegativeWeights())
+        throw std::invalid_argument("Graph contains negative edge weights.");
+
+    workspace.search(graph, source, target, &heuristic, allowAll);
+}
+
+Heuristic euclideanHeuristic(
+    const std::vector<std::pair<double, double>>& coordinates, size_t target)
+{
+    if (target >= coordinates.size())
+        throw std::out_of_range("Target vertex has no coordinates.");
+
+    return [coordinates, target](size_t vertex) {
+        if (vertex >= coordinates.size())
+            throw std::out_of_range("Vertex has no coordinates.");
+        double dx = coordinates[vertex].first - coordinates[target].first;
+        double dy = coordinates[vertex].second - coordinates[target].second;
+        return static_cast<int>(std::floor(std::hypot(dx, dy)));
+    };
+}
+
+Heuristic landmarkHeuristic(const std::vector<std::vector<int>>& landmarkDistances, size_t target)
+{
+    for (const std::vector<int>& fromLandmark : landmarkDistances)
+        if (target >= fromLandmark.size())
+            throw std::out_of_range("Target vertex is out of range.");
+
+    return [landmarkDistances, target](size_t vertex) {
+        int bound = 0;
+        for (const std::vector<int>& fromLandmark : landmarkDistances) {
+            if (vertex >= fromLandmark.size())
+                throw std::out_of_range("Vertex is out of range.");
+            // dist(L, target) <= dist(L, v) + dist(v, target); unreachable entries give no bound.
+            if (fromLandmark[target] == INF || fromLandmark[vertex] == INF)
+                continue;
+            bound = std::max(bound, fromLandmark[target] - fromLandmark[vertex]);
+        }
+        return bound;
+    };
+}
+
+std::vector<std::pair<std::vector<int>, int>> kShortestPaths(const CsrGraph& graph, size_t source,
+    size_t target, size_t k, KShortestPathsMode mode, size_t numThreads)
+{
+    if (source >= graph.getNumVertices() || target >= graph.getNumVertices())
+        throw std::out_of_range("Source or target vertex is out of range.");
+    if (graph.hasNegativeWeights())
+        throw std::invalid_argument("Graph contains negative edge weights.");
+    if (k == 0)
+        return {};
+
+    if (mode == KShortestPathsMode::Walks)
+        return walkPaths(graph, source, target, k);
+    return looplessPaths(graph, source, target, k, numThreads);
+}
+
+std::vector<std::pair<std::vector<int>, int>> kShortestPaths(const Graph& graph, size_t source,
+    size_t target, size_t k, KShortestPathsMode mode, size_t numThreads)
+{
+    if (source >= graph.getNumVertices() || target >= graph.getNumVertices())
+        throw std::out_of_range("Source or target vertex is out of range.");
+
+    return kShortestPaths(CsrGraph(graph), source, target, k, mode, numThreads);
 }
 
-std::pair<std::vector<int>, std::vector<int>> bellmanFord(const Graph& graph, size_t source)
+template <DistanceType Distance>
+std::pair<std::vector<Distance>, std::vector<int>> bellmanFord(
+    const Graph& graph, size_t source, BellmanFordMode mode)
 {
+    if (source >= graph.getNumVertices())
+        throw std::out_of_range("Source vertex is out of range.");
+
+    return bellmanFord<Distance>(CsrGraph(graph), source, mode);
+}
+
+template <DistanceType Distance>
+std::pair<std::vector<Distance>, std::vector<int>> bellmanFord(
+    const CsrGraph& graph, size_t source, BellmanFordMode mode)
+{
+    const Distance unreached = unreachableDistance<Distance>();
     size_t n = graph.getNumVertices();
 
     if (source >= n)
         throw std::out_of_range("Source vertex is out of range.");
 
-    const int INF = std::numeric_limits<int>::max();
-    std::vector<int> dist(n, INF);
+    std::vector<Distance> dist(n, unreached);
     std::vector<int> pred(n, -1);
     dist[source] = 0;
 
-    // Relax all edges (n - 1) times.
-    for (size_t i = 0; i < n - 1; ++i) {
+    if (mode == BellmanFordMode::Queue) {
+        // FIFO queue of vertices whose distance changed since they were last scanned.
+        std::queue<size_t> toRelax;
+        std::vector<bool> inQueue(n, false);
+        std::vector<size_t> timesEnqueued(n, 0);
+        toRelax.push(source);
+        inQueue[source] = true;
+        timesEnqueued[source] = 1;
+
+        while (!toRelax.empty()) {
+            size_t u = toRelax.front();
+            toRelax.pop();
+            inQueue[u] = false;
+
+            std::span<const int> neighbors = graph.getNeighbors(u);
+            std::span<const int> weights = graph.getWeights(u);
+            for (size_t i = 0; i < neighbors.size(); ++i) {
+                size_t v = static_cast<size_t>(neighbors[i]);
+                Distance candidate = extend(dist[u], weights[i]);
+                if (candidate < dist[v]) {
+                    dist[v] = candidate;
+                    pred[v] = static_cast<int>(u);
+                    if (!inQueue[v]) {
+                        // Without a negative cycle a vertex is enqueued at most once per pass.
+                        if (++timesEnqueued[v] > n)
+                            throw std::runtime_error("Graph contains a negative cycle.");
+                        toRelax.push(v);
+                        inQueue[v] = true;
+                    }
+                }
+            }
+        }
+
+        return { dist, pred };
+    }
+
+    // Relaxes every edge once; returns true if any distance improved.
+    auto relaxAll = [&](bool detectOnly) {
+        bool updated = false;
         for (size_t u = 0; u < n; ++u) {
-            if (dist[u] == INF)
-                continue;
+            // Floating-point infinity absorbs any weight, so only integers need this guard.
+            if constexpr (!std::numeric_limits<Distance>::has_infinity)
+                if (dist[u] == unreached)
+                    continue;
 
-            std::vector<int> neighbors = graph.getNeighbors(u);
-            for (int neighbor : neighbors) {
-                size_t v = static_cast<size_t>(neighbor);
-                int weight = graph.getEdgeWeight(u, v);
-                if (dist[u] + weight < dist[v]) {
-                    dist[v] = dist[u] + weight;
+            std::span<const int> neighbors = graph.getNeighbors(u);
+            std::span<const int> weights = graph.getWeights(u);
+            for (size_t i = 0; i < neighbors.size(); ++i) {
+                size_t v = static_cast<size_t>(neighbors[i]);
+                Distance candidate = extend(dist[u], weights[i]);
+                if (candidate < dist[v]) {
+                    if (detectOnly)
+                        return true;
+                    dist[v] = candidate;
                     pred[v] = static_cast<int>(u);
+                    updated = true;
                 }
             }
         }
+        return updated;
+    };
+
+    // Relax all edges (n - 1) times, or until a pass changes nothing.
+    bool earlyExit = mode == BellmanFordMode::EarlyExit;
+    bool updated = true;
+    for (size_t i = 0; i + 1 < n && (updated || !earlyExit); ++i)
+        updated = relaxAll(false);
+
+    // Check for negative cycles; a pass without updates already proves there are none.
+    if ((updated || !earlyExit) && relaxAll(true))
+        throw std::runtime_error("Graph contains a negative cycle.");
+
+    return { dist, pred };
+}
+
+std::pair<std::vector<int>, std::vector<int>> parallelBellmanFord(
+    const CsrGraph& graph, size_t source, size_t numThreads)
+{
+    size_t n = graph.getNumVertices();
+
+    if (source >= n)
+        throw std::out_of_range("Source vertex is out of range.");
+
+    // The transpose stores the incoming edges of every head contiguously, tails aligned with
+    // weights, so a round streams it once.
+    CsrGraph incoming = graph.transpose();
+
+    // Give each thread a contiguous range of heads holding about the same number of edges.
+    size_t threads = resolveThreadCount(numThreads, n);
+    std::vector<size_t> firstHead(threads + 1, n);
+    firstHead[0] = 0;
+    for (size_t t = 1, v = 0; t < threads; ++t) {
+        size_t edgeTarget = incoming.getNumEdges() * t / threads;
+        while (v < n && incoming.edgeBegin(v) < edgeTarget)
+            ++v;
+        firstHead[t] = std::max(v, firstHead[t - 1]);
     }
 
-    // Check for negative cycles.
-    for (size_t u = 0; u < n; ++u) {
-        if (dist[u] == INF)
-            continue;
+    std::vector<int> current(n, INF);
+    std::vector<int> next(n, INF);
+    std::vector<int> pred(n, -1);
+    current[source] = 0;
+
+    std::vector<char> updatedBy(threads, 0);
+    // Workers must not throw across the barrier, so each keeps its own overflow for the end.
+    std::vector<std::exception_ptr> failures(threads);
+    size_t round = 0;
+    bool done = false;
+    bool negativeCycle = false;
+
+    // Runs once per round after every worker has written its heads into next.
+    auto finishRound = [&]() noexcept {
+        bool updated = std::find(updatedBy.begin(), updatedBy.end(), 1) != updatedBy.end();
+        current.swap(next);
+        ++round;
+        // Round r settles every shortest path of at most r edges, so an update in round n can
+        // only come from a negative cycle.
+        if (std::find_if(failures.begin(), failures.end(), [](const std::exception_ptr& failure) {
+                return failure != nullptr;
+            }) != failures.end())
+            done = true;
+        else if (!updated)
+            done = true;
+        else if (round == n)
+            done = negativeCycle = true;
+    };
+    std::barrier sync(static_cast<std::ptrdiff_t>(threads), finishRound);
+
+    runWorkers(threads, [&](size_t worker) {
+        while (!done) {
+            bool updated = false;
+            try {
+                for (size_t v = firstHead[worker]; v < firstHead[worker + 1]; ++v) {
+                    int best = current[v];
+                    std::span<const int> tails = incoming.getNeighbors(v);
+                    std::span<const int> weights = incoming.getWeights(v);
+                    for (size_t e = 0; e < tails.size(); ++e) {
+                        int tailDist = current[static_cast<size_t>(tails[e])];
+                        if (tailDist == INF)
+                            continue;
+                        int candidate = extend(tailDist, weights[e]);
+                        if (candidate < best) {
+                            best = candidate;
+                            pred[v] = tails[e];
+                        }
+                    }
+                    updated = updated || best < current[v];
+                    next[v] = best;
+                }
+            } catch (...) {
+                failures[worker] = std::current_exception();
+            }
+            updatedBy[worker] = updated ? 1 : 0;
+            sync.arrive_and_wait();
+        }
+    });
+
+    for (const std::exception_ptr& failure : failures)
+        if (failure)
+            std::rethrow_exception(failure);
+    if (negativeCycle)
+        throw std::runtime_error("Graph contains a negative cycle.");
+
+    return { current, pred };
+}
+
+DistanceMatrix johnson(
+    const CsrGraph& graph, MatrixLayout layout, DistanceWidth width, size_t numThreads)
+{
+    size_t n = graph.getNumVertices();
+    DistanceMatrix matrix(n, layout, width);
+    std::vector<int> potential(n, 0);
+    CsrGraph reweighted;
+
+    if (graph.hasNegativeWeights()) {
+        // Potentials are distances from a virtual source joined to every vertex by a 0 edge.
+        std::vector<CsrGraph::Edge> edges = graph.getEdges();
+        for (size_t v = 0; v < n; ++v)
+            edges.push_back({ static_cast<int>(n), static_cast<int>(v), 0 });
+        potential = bellmanFord(CsrGraph(n + 1, edges), n).first;
+        potential.pop_back();
 
-        std::vector<int> neighbors = graph.getNeighbors(u);
-        for (int neighbor : neighbors) {
-            size_t v = static_cast<size_t>(neighbor);
-            int weight = graph.getEdgeWeight(u, v);
-            if (dist[u] + weight < dist[v])
-                throw std::runtime_error("Graph contains a negative cycle.");
+        // Reweighted edges are non-negative but can exceed the original weights.
+        edges.resize(graph.getNumEdges());
+        for (CsrGraph::Edge& edge : edges) {
+            long long weight = static_cast<long long>(edge.weight)
+                + potential[static_cast<size_t>(edge.from)]
+                - potential[static_cast<size_t>(edge.to)];
+            if (weight >= INF)
+                throw std::overflow_error("Path length overflows the distance type.");
+            edge.weight = static_cast<int>(weight);
         }
+        reweighted = CsrGraph(n, edges);
     }
 
-    return { dist, pred };
+    std::vector<int> sources(n);
+    for (size_t v = 0; v < n; ++v)
+        sources[v] = static_cast<int>(v);
+
+    batchDijkstra(
+        graph.hasNegativeWeights() ? reweighted : graph, sources,
+        [&](size_t source, const ShortestPathWorkspace& workspace) {
+            for (int v : workspace.getSettled()) {
+                size_t target = static_cast<size_t>(v);
+                long long distance = static_cast<long long>(workspace.getDistance(target))
+                    - potential[source] + potential[target];
+                // INT_MAX itself marks unreachable pairs, so it is out of range as a distance.
+                if (distance < std::numeric_limits<int>::min() || distance >= INF)
+                    throw std::overflow_error("Path length overflows the distance type.");
+                matrix.set(source, target, static_cast<int>(distance));
+            }
+        },
+        numThreads);
+
+    return matrix;
+}
+
+DistanceMatrix johnson(
+    const Graph& graph, MatrixLayout layout, DistanceWidth width, size_t numThreads)
+{
+    return johnson(CsrGraph(graph), layout, width, numThreads);
 }
 
 std::vector<int> topologicalSort(const Graph& graph)
+{
+    return topologicalSort(CsrGraph(graph));
+}
+
+std::vector<int> topologicalSort(const CsrGraph& graph)
 {
     size_t n = graph.getNumVertices();
     std::vector<int> inDegree(n, 0);
-    std::queue<int> toTraverse;
     std::vector<int> result;
+    result.reserve(n);
 
     // Calculate in-degree of each vertex.
-    for (size_t vertex = 0; vertex < n; ++vertex) {
-        std::vector<int> neighbors = graph.getNeighbors(vertex);
-        for (int neighbor : neighbors)
+    for (size_t vertex = 0; vertex < n; ++vertex)
+        for (int neighbor : graph.getNeighbors(vertex))
             ++inDegree[static_cast<size_t>(neighbor)];
-    }
 
-    // Add all zero in-degree vertices to a queue.
+    // The result doubles as the queue: zero in-degree vertices are appended and processed in turn.
     for (size_t u = 0; u < n; ++u)
         if (inDegree[u] == 0)
-            toTraverse.push(static_cast<int>(u));
-
-    // Process vertices in topological order.
-    while (!toTraverse.empty()) {
-        int sourceVertex = toTraverse.front();
-        toTraverse.pop();
-        result.push_back(sourceVertex);
-
-        std::vector<int> neighbors = graph.getNeighbors(static_cast<size_t>(sourceVertex));
-        for (int neighbor : neighbors) {
-            --inDegree[static_cast<size_t>(neighbor)];
-            if (inDegree[static_cast<size_t>(neighbor)] == 0)
-                toTraverse.push(neighbor);
+            result.push_back(static_cast<int>(u));
+
+    for (size_t head = 0; head < result.size(); ++head)
+        for (int neighbor : graph.getNeighbors(static_cast<size_t>(result[head])))
+            if (--inDegree[static_cast<size_t>(neighbor)] == 0)
+                result.push_back(neighbor);
+
+    if (result.size() != n)
+        throw std::runtime_error("Graph contains a cycle.");
+
+    return result;
+}
+
+std::vector<std::vector<int>> topologicalLevels(const CsrGraph& graph, size_t numThreads)
+{
+    size_t n = graph.getNumVertices();
+    size_t threads = resolveThreadCount(numThreads, n);
+    size_t parallelThreshold
+        = threads > 1 ? PARALLEL_LEVEL_SIZE : std::numeric_limits<size_t>::max();
+
+    std::vector<std::atomic<int>> inDegree(n);
+    parallelFor((n + LEVEL_CHUNK - 1) / LEVEL_CHUNK, threads, [&](size_t, size_t chunk) {
+        for (size_t v = chunk * LEVEL_CHUNK; v < std::min(n, (chunk + 1) * LEVEL_CHUNK); ++v)
+            for (int next : graph.getNeighbors(v))
+                inDegree[static_cast<size_t>(next)].fetch_add(1, std::memory_order_relaxed);
+    });
+
+    // The thread whose decrement reaches zero owns the vertex; the barrier publishes the buffers.
+    auto expand
+        = [&](const std::vector<int>& level, size_t begin, size_t end, std::vector<int>& out) {
+              for (size_t i = begin; i < end; ++i)
+                  for (int next : graph.getNeighbors(static_cast<size_t>(level[i]))) {
+                      std::atomic<int>& degree = inDegree[static_cast<size_t>(next)];
+                      if (degree.fetch_sub(1, std::memory_order_relaxed) == 1)
+                          out.push_back(next);
+                  }
+          };
+
+    std::vector<std::vector<int>> levels;
+    std::vector<std::vector<int>> discovered(threads);
+    std::atomic<size_t> nextChunk { 0 };
+    size_t placed = 0;
+    bool done = false;
+
+    // Appends next and keeps expanding on this thread while the levels stay small; stops at the
+    // first large level, which the workers then expand together.
+    auto advance = [&](std::vector<int> next) {
+        while (!next.empty()) {
+            placed += next.size();
+            levels.push_back(std::move(next));
+            next = {};
+            if (levels.back().size() >= parallelThreshold) {
+                nextChunk = 0;
+                return;
+            }
+            expand(levels.back(), 0, levels.back().size(), next);
         }
+        done = true;
+    };
+
+    std::vector<int> first;
+    for (size_t v = 0; v < n; ++v)
+        if (inDegree[v].load(std::memory_order_relaxed) == 0)
+            first.push_back(static_cast<int>(v));
+    advance(std::move(first));
+
+    if (!done) {
+        auto merge = [&]() noexcept {
+            std::vector<int> next;
+            for (std::vector<int>& buffer : discovered) {
+                next.insert(next.end(), buffer.begin(), buffer.end());
+                buffer.clear();
+            }
+            advance(std::move(next));
+        };
+        std::barrier expanded(static_cast<std::ptrdiff_t>(threads), merge);
+
+        runWorkers(threads, [&](size_t worker) {
+            while (!done) {
+                const std::vector<int>& level = levels.back();
+                for (size_t begin = nextChunk.fetch_add(LEVEL_CHUNK); begin < level.size();
+                     begin = nextChunk.fetch_add(LEVEL_CHUNK))
+                    expand(level, begin, std::min(begin + LEVEL_CHUNK, level.size()),
+                        discovered[worker]);
+                expanded.arrive_and_wait();
+            }
+        });
     }
 
-    if (result.size() != n)
+    if (placed != n)
         throw std::runtime_error("Graph contains a cycle.");
 
+    return levels;
+}
+
+std::vector<std::vector<int>> topologicalLevels(const Graph& graph, size_t numThreads)
+{
+    return topologicalLevels(CsrGraph(graph), numThreads);
+}
+
+CriticalPathResult criticalPath(const CsrGraph& graph, size_t numThreads)
+{
+    size_t n = graph.getNumVertices();
+    std::vector<std::vector<int>> levels = topologicalLevels(graph, numThreads);
+    CsrGraph reverse = graph.transpose();
+
+    CriticalPathResult result;
+    result.lengths.assign(n, 0);
+    result.predecessors.assign(n, -1);
+
+    // Every in-neighbor lies in an earlier level, so the vertices of a level only read. A vertex
+    // starts at the empty path ending there, so negative edges are taken only when they pay off.
+    auto pull = [&](size_t v) {
+        std::span<const int> tails = reverse.getNeighbors(v);
+        std::span<const int> weights = reverse.getWeights(v);
+        for (size_t i = 0; i < tails.size(); ++i) {
+            size_t u = static_cast<size_t>(tails[i]);
+            int candidate = extend<int>(result.lengths[u], weights[i]);
+            if (candidate > result.lengths[v]) {
+                result.lengths[v] = candidate;
+                result.predecessors[v] = tails[i];
+            }
+        }
+    };
+
+    for (const std::vector<int>& level : levels) {
+        if (level.size() < PARALLEL_LEVEL_SIZE) {
+            for (int v : level)
+                pull(static_cast<size_t>(v));
+            continue;
+        }
+        parallelFor((level.size() + LEVEL_CHUNK - 1) / LEVEL_CHUNK, numThreads,
+            [&](size_t, size_t chunk) {
+                size_t end = std::min(level.size(), (chunk + 1) * LEVEL_CHUNK);
+                for (size_t i = chunk * LEVEL_CHUNK; i < end; ++i)
+                    pull(static_cast<size_t>(level[i]));
+            });
+    }
+
+    if (n == 0)
+        return result;
+
+    size_t last = 0;
+    for (size_t v = 1; v < n; ++v)
+        if (result.lengths[v] > result.lengths[last])
+            last = v;
+    result.length = result.lengths[last];
+    for (int v = static_cast<int>(last); v >= 0; v = result.predecessors[static_cast<size_t>(v)])
+        result.path.push_back(v);
+    std::reverse(result.path.begin(), result.path.end());
+
     return result;
 }
+
+CriticalPathResult criticalPath(const Graph& graph, size_t numThreads)
+{
+    return criticalPath(CsrGraph(graph), numThreads);
+}
+
+// The shortest-path templates are defined here and instantiated for every DistanceType.
+#define INSTANTIATE_SHORTEST_PATHS(Distance)                                                       \
+    template class BasicShortestPathWorkspace<Distance>;                                           \
+    template std::pair<std::vector<Distance>, std::vector<int>> dijkstra<Distance>(                \
+        const Graph&, size_t);                                                                     \
+    template void dijkstra<Distance>(                                                              \
+        const CsrGraph&, size_t, BasicShortestPathWorkspace<Distance>&);                           \
+    template void aStar<Distance>(const CsrGraph&, size_t, size_t, const Heuristic&,               \
+        BasicShortestPathWorkspace<Distance>&);                                                    \
+    template void dijkstra<Distance>(                                                              \
+        const MaskedGraphView&, size_t, size_t, BasicShortestPathWorkspace<Distance>&);            \
+    template std::pair<std::vector<Distance>, std::vector<int>> bellmanFord<Distance>(             \
+        const Graph&, size_t, BellmanFordMode);                                                    \
+    template std::pair<std::vector<Distance>, std::vector<int>> bellmanFord<Distance>(             \
+        const CsrGraph&, size_t, BellmanFordMode);
+
+INSTANTIATE_SHORTEST_PATHS(int)
+INSTANTIATE_SHORTEST_PATHS(std::int64_t)
+INSTANTIATE_SHORTEST_PATHS(float)
+INSTANTIATE_SHORTEST_PATHS(double)
@@ -0,0 +1,434 @@
+#include "Connectivity.h"
+#include "Parallel.h"
+#include "UnionFind.h"
+#include <algorithm>
+#include <atomic>
+#include <random>
+#include <unordered_map>
+
+namespace {
+
+using Labels = std::vector<std::atomic<int>>;
+
+// Out-edges per vertex linked before the giant component is sampled.
+const size_t NEIGHBOR_ROUNDS = 2;
+
+// Vertices sampled to find the largest intermediate component.
+const size_t SAMPLE_SIZE = 1024;
+
+// Vertices handed to a worker at a time.
+const size_t VERTEX_CHUNK = 4096;
+
+/**
+ * Runs body(v) for every vertex on a pool of threads, in chunks of consecutive vertices.
+ */
+template <typename Body> void forEachVertex(size_t n, size_t numThreads, Body&& body)
+{
+    parallelFor((n + VERTEX_CHUNK - 1) / VERTEX_CHUNK, numThreads, [&](size_t, size_t chunk) {
+        size_t end = std::min(n, (chunk + 1) * VERTEX_CHUNK);
+        for (size_t v = chunk * VERTEX_CHUNK; v < end; ++v)
+            body(v);
+    });
+}
+
+int load(const Labels& labels, int vertex)
+{
+    return labels[static_cast<size_t>(vertex)].load(std::memory_order_relaxed);
+}
+
+/**
+ * Merges the trees of u and v. Only a root may be relinked, and only to a smaller vertex, so the
+ * compare-and-swap fails exactly when another thread relinked it first and the walk continues.
+ */
+void link(Labels& labels, int u, int v)
+{
+    int p1 = load(labels, u);
+    int p2 = load(labels, v);
+    while (p1 != p2) {
+        int high = std::max(p1, p2);
+        int low = std::min(p1, p2);
+        int highParent = load(labels, high);
+        if (highParent == low)
+            return;
+        if (highParent == high
+            && labels[static_cast<size_t>(high)].compare_exchange_strong(
+                highParent, low, std::memory_order_relaxed))
+            return;
+        p1 = load(labels, load(labels, high));
+        p2 = load(labels, low);
+    }
+}
+
+/**
+ * Points a vertex directly at its root.
+ */
+void compress(Labels& labels, size_t vertex)
+{
+    int v = static_cast<int>(vertex);
+    for (int parent = load(labels, v); parent != load(labels, parent); parent = load(labels, v))
+        labels[vertex].store(load(labels, parent), std::memory_order_relaxed);
+}
+
+/**
+ * Returns the most frequent label among randomly sampled vertices.
+ */
+int sampleFrequentLabel(const Labels& labels)
+{
+    std::mt19937 gen(0);
+    std::uniform_int_distribution<size_t> vertexDist(0, labels.size() - 1);
+    std::unordered_map<int, size_t> counts;
+    int best = 0;
+    size_t bestCount = 0;
+    for (size_t i = 0; i < SAMPLE_SIZE; ++i) {
+        int label = load(labels, static_cast<int>(vertexDist(gen)));
+        size_t count = ++counts[label];
+        if (count > bestCount) {
+            best = label;
+            bestCount = count;
+        }
+    }
+    return best;
+}
+
+/**
+ * Simple undirected adjacency in CSR form: both directions of every edge, no loops or duplicates.
+ */
+struct UndirectedAdjacency {
+    std::vector<size_t> offsets;
+    std::vector<int> targets;
+
+    std::span<const int> neighbors(size_t vertex) const
+    {
+        return { targets.data() + offsets[vertex], offsets[vertex + 1] - offsets[vertex] };
+    }
+};
+
+UndirectedAdjacency makeUndirected(const CsrGraph& graph)
+{
+    size_t n = graph.getNumVertices();
+    UndirectedAdjacency adjacency;
+    adjacency.offsets.assign(n + 1, 0);
+    for (size_t u = 0; u < n; ++u)
+        for (int v : graph.getNeighbors(u))
+            if (static_cast<size_t>(v) != u) {
+                ++adjacency.offsets[u + 1];
+                ++adjacency.offsets[static_cast<size_t>(v) + 1];
+            }
+    for (size_t u = 0; u < n; ++u)
+        adjacency.offsets[u + 1] += adjacency.offsets[u];
+
+    std::vector<int> targets(adjacency.offsets[n]);
+    std::vector<size_t> fill(adjacency.offsets.begin(), adjacency.offsets.end() - 1);
+    for (size_t u = 0; u < n; ++u)
+        for (int v : graph.getNeighbors(u))
+            if (static_cast<size_t>(v) != u) {
+                targets[fill[u]++] = v;
+                targets[fill[static_cast<size_t>(v)]++] = static_cast<int>(u);
+            }
+
+    // Sort each row and drop repeats, compacting the rows in place.
+    size_t write = 0;
+    for (size_t u = 0; u < n; ++u) {
+        auto begin = targets.begin() + static_cast<std::ptrdiff_t>(adjacency.offsets[u]);
+        auto end = targets.begin() + static_cast<std::ptrdiff_t>(adjacency.offsets[u + 1]);
+        std::sort(begin, end);
+        adjacency.offsets[u] = write;
+        for (auto it = begin; it != end; ++it)
+            if (it == begin || *it != *(it - 1))
+                targets[write++] = *it;
+    }
+    adjacency.offsets[n] = write;
+    targets.resize(write);
+    adjacency.targets = std::move(targets);
+    return adjacency;
+}
+
+/**
+ * Sorts every list of a result so that equal decompositions compare equal.
+ */
+void normalize(BiconnectedResult& result)
+{
+    for (std::vector<int>& component : result.components)
+        std::sort(component.begin(), component.end());
+    std::sort(result.components.begin(), result.components.end());
+    std::sort(result.articulationPoints.begin(), result.articulationPoints.end());
+    std::sort(result.bridges.begin(), result.bridges.end());
+}
+
+} // namespace
+
+std::vector<int> connectedComponents(const CsrGraph& graph, size_t numThreads)
+{
+    size_t n = graph.getNumVertices();
+    if (n == 0)
+        return {};
+
+    Labels labels(n);
+    forEachVertex(n, numThreads, [&](size_t v) {
+        labels[v].store(static_cast<int>(v), std::memory_order_relaxed);
+    });
+
+    // Linking a few edges per vertex already joins most of a giant component.
+    for (size_t round = 0; round < NEIGHBOR_ROUNDS; ++round) {
+        forEachVertex(n, numThreads, [&](size_t v) {
+            std::span<const int> neighbors = graph.getNeighbors(v);
+            if (round < neighbors.size())
+                link(labels, static_cast<int>(v), neighbors[round]);
+        });
+        forEachVertex(n, numThreads, [&](size_t v) { compress(labels, v); });
+    }
+
+    // An edge whose endpoints both point at the frequent label is already inside one tree. Edges
+    // are only stored at their source, so the skip tests both endpoints instead of skipping the
+    // giant component's adjacency lists wholesale, which would miss in-edges of directed graphs.
+    int frequent = sampleFrequentLabel(labels);
+    forEachVertex(n, numThreads, [&](size_t v) {
+        std::span<const int> neighbors = graph.getNeighbors(v);
+        bool inFrequent = load(labels, static_cast<int>(v)) == frequent;
+        for (size_t i = NEIGHBOR_ROUNDS; i < neighbors.size(); ++i)
+            if (!inFrequent || load(labels, neighbors[i]) != frequent)
+                link(labels, static_cast<int>(v), neighbors[i]);
+    });
+    forEachVertex(n, numThreads, [&](size_t v) { compress(labels, v); });
+
+    std::vector<int> result(n);
+    forEachVertex(
+        n, numThreads, [&](size_t v) { result[v] = labels[v].load(std::memory_order_relaxed); });
+    return result;
+}
+
+std::vector<int> connectedComponents(const Graph& graph, size_t numThreads)
+{
+    return connectedComponents(CsrGraph(graph), numThreads);
+}
+
+BiconnectedResult biconnectedComponents(const CsrGraph& graph)
+{
+    size_t n = graph.getNumVertices();
+    UndirectedAdjacency adjacency = makeUndirected(graph);
+    BiconnectedResult result;
+
+    std::vector<int> order(n, -1); // discovery order, -1 until visited
+    std::vector<int> low(n, 0);
+    std::vector<int> parent(n, -1);
+    std::vector<bool> isArticulation(n, false);
+    std::vector<std::pair<int, size_t>> frames; // vertex and index of its next neighbor
+    std::vector<std::pair<int, int>> edges; // tree and back edges of unfinished components
+    int discovered = 0;
+
+    for (size_t root = 0; root < n; ++root) {
+        if (order[root] >= 0)
+            continue;
+
+        size_t rootChildren = 0;
+        order[root] = low[root] = discovered++;
+        frames.emplace_back(static_cast<int>(root), 0);
+
+        while (!frames.empty()) {
+            auto& [vertex, next] = frames.back();
+            size_t u = static_cast<size_t>(vertex);
+            std::span<const int> neighbors = adjacency.neighbors(u);
+
+            if (next < neighbors.size()) {
+                int w = neighbors[next++];
+                size_t x = static_cast<size_t>(w);
+                if (order[x] < 0) {
+                    parent[x] = vertex;
+                    order[x] = low[x] = discovered++;
+                    edges.emplace_back(vertex, w);
+                    rootChildren += u == root;
+                    frames.emplace_back(w, 0);
+                } else if (w != parent[u] && order[x] < order[u]) {
+                    edges.emplace_back(vertex, w);
+                    low[u] = std::min(low[u], order[x]);
+                }
+                continue;
+            }
+
+            int finished = vertex;
+            frames.pop_back();
+            if (parent[u] < 0)
+                continue;
+
+            // Finishing u closes a component at its parent p unless u's subtree climbs above p.
+            size_t p = static_cast<size_t>(parent[u]);
+            low[p] = std::min(low[p], low[u]);
+            if (low[u] >= order[p]) {
+                isArticulation[p] = p != root || rootChildren > 1;
+                if (low[u] > order[p])
+                    result.bridges.emplace_back(
+                        std::min(parent[u], finished), std::max(parent[u], finished));
+
+                std::vector<int> component;
+                std::pair<int, int> edge;
+                do {
+                    edge = edges.back();
+                    edges.pop_back();
+                    component.push_back(edge.first);
+                    component.push_back(edge.second);
+                } while (edge != std::pair<int, int>(parent[u], finished));
+                std::sort(component.begin(), component.end());
+                component.erase(std::unique(component.begin(), component.end()), component.end());
+                result.components.push_back(std::move(component));
+            }
+        }
+    }
+
+    for (size_t v = 0; v < n; ++v)
+        if (isArticulation[v])
+            result.articulationPoints.push_back(static_cast<int>(v));
+    normalize(result);
+    return result;
+}
+
+BiconnectedResult biconnectedComponents(const Graph& graph)
+{
+    return biconnectedComponents(CsrGraph(graph));
+}
+
+BiconnectedResult parallelBiconnectedComponents(const CsrGraph& graph, size_t numThreads)
+{
+    size_t n = graph.getNumVertices();
+    UndirectedAdjacency adjacency = makeUndirected(graph);
+
+    // BFS spanning forest; order lists every tree's vertices after its root, parents first.
+    std::vector<int> parent(n, -1);
+    std::vector<int> order;
+    order.reserve(n);
+    std::vector<bool> reached(n, false);
+    for (size_t root = 0; root < n; ++root) {
+        if (reached[root])
+            continue;
+        reached[root] = true;
+        size_t head = order.size();
+        order.push_back(static_cast<int>(root));
+        for (; head < order.size(); ++head) {
+            int u = order[head];
+            for (int w : adjacency.neighbors(static_cast<size_t>(u)))
+                if (!reached[static_cast<size_t>(w)]) {
+                    reached[static_cast<size_t>(w)] = true;
+                    parent[static_cast<size_t>(w)] = u;
+                    order.push_back(w);
+                }
+        }
+    }
+
+    // Preorder numbers and subtree sizes, so "a is an ancestor of b" is an interval test.
+    std::vector<int> subtreeSize(n, 1);
+    for (size_t i = n; i-- > 0;) {
+        int v = order[i];
+        if (parent[static_cast<size_t>(v)] >= 0)
+            subtreeSize[static_cast<size_t>(parent[static_cast<size_t>(v)])]
+                += subtreeSize[static_cast<size_t>(v)];
+    }
+    std::vector<int> preorder(n, 0);
+    std::vector<int> nextChild(n, 0); // preorder number handed to a vertex's next child
+    for (size_t i = 0; i < n; ++i) {
+        size_t x = static_cast<size_t>(order[i]);
+        // A tree occupies a contiguous run of order, so its root's position starts its interval.
+        if (parent[x] < 0) {
+            preorder[x] = static_cast<int>(i);
+        } else {
+            int& slot = nextChild[static_cast<size_t>(parent[x])];
+            preorder[x] = slot;
+            slot += subtreeSize[x];
+        }
+        nextChild[x] = preorder[x] + 1;
+    }
+    auto isAncestor = [&](size_t a, size_t b) {
+        return preorder[a] <= preorder[b] && preorder[b] < preorder[a] + subtreeSize[a];
+    };
+    auto isTreeEdge = [&](size_t a, size_t b) {
+        return parent[a] == static_cast<int>(b) || parent[b] == static_cast<int>(a);
+    };
+
+    // low/high: smallest and largest preorder number a subtree reaches through a non-tree edge.
+    std::vector<int> low(preorder), high(preorder);
+    forEachVertex(n, numThreads, [&](size_t v) {
+        for (int w : adjacency.neighbors(v)) {
+            size_t x = static_cast<size_t>(w);
+            if (!isTreeEdge(v, x)) {
+                low[v] = std::min(low[v], preorder[x]);
+                high[v] = std::max(high[v], preorder[x]);
+            }
+        }
+    });
+    for (size_t i = n; i-- > 0;) {
+        size_t v = static_cast<size_t>(order[i]);
+        if (parent[v] >= 0) {
+            size_t p = static_cast<size_t>(parent[v]);
+            low[p] = std::min(low[p], low[v]);
+            high[p] = std::max(high[p], high[v]);
+        }
+    }
+
+    // Tree edge (parent[v], v) is element v. Non-tree edges join their endpoints' tree edges when
+    // the endpoints are unrelated, and a tree edge joins its parent's when its subtree escapes it.
+    ConcurrentUnionFind treeEdges(n);
+    forEachVertex(n, numThreads, [&](size_t v) {
+        if (parent[v] < 0)
+            return;
+        size_t p = static_cast<size_t>(parent[v]);
+        if (parent[p] >= 0 && (low[v] < preorder[p] || high[v] >= preorder[p] + subtreeSize[p]))
+            treeEdges.unite(v, p);
+        for (int w : adjacency.neighbors(v)) {
+            size_t x = static_cast<size_t>(w);
+            if (preorder[x] < preorder[v] && !isTreeEdge(v, x) && !isAncestor(x, v))
+                treeEdges.unite(v, x);
+        }
+    });
+
+    // Every component contains a tree edge, so grouping tree edges yields all of them.
+    std::vector<int> label(n, -1);
+    std::vector<int> edgeCount(n, 0);
+    forEachVertex(n, numThreads, [&](size_t v) {
+        if (parent[v] >= 0)
+            label[v] = treeEdges.find(v);
+    });
+    BiconnectedResult result;
+    std::vector<int> componentIndex(n, -1);
+    for (size_t v = 0; v < n; ++v) {
+        if (label[v] < 0)
+            continue;
+        size_t l = static_cast<size_t>(label[v]);
+        if (componentIndex[l] < 0) {
+            componentIndex[l] = static_cast<int>(result.components.size());
+            result.components.emplace_back();
+        }
+        std::vector<int>& component
+            = result.components[static_cast<size_t>(componentIndex[l])];
+        component.push_back(static_cast<int>(v));
+        component.push_back(parent[v]);
+        ++edgeCount[l];
+    }
+    for (std::vector<int>& component : result.components) {
+        std::sort(component.begin(), component.end());
+        component.erase(std::unique(component.begin(), component.end()), component.end());
+    }
+
+    // A non-tree edge always closes a cycle, so a single-edge component is a bridge. A vertex is
+    // an articulation point iff its incident tree edges fall into more than one component.
+    std::vector<int> seenLabel(n, -1);
+    std::vector<bool> isArticulation(n, false);
+    for (size_t v = 0; v < n; ++v) {
+        if (label[v] < 0)
+            continue;
+        size_t p = static_cast<size_t>(parent[v]);
+        if (edgeCount[static_cast<size_t>(label[v])] == 1)
+            result.bridges.emplace_back(
+                std::min(parent[v], static_cast<int>(v)), std::max(parent[v], static_cast<int>(v)));
+        for (size_t endpoint : { v, p }) {
+            // The first tree edge seen at a vertex is its parent edge, or its first child's edge.
+            if (seenLabel[endpoint] < 0)
+                seenLabel[endpoint] = label[v];
+            else if (seenLabel[endpoint] != label[v])
+                isArticulation[endpoint] = true;
+        }
+    }
+    for (size_t v = 0; v < n; ++v)
+        if (isArticulation[v])
+            result.articulationPoints.push_back(static_cast<int>(v));
+
+    normalize(result);
+    return result;
+}
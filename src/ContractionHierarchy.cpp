@@ -0,0 +1,566 @@
+#include "ContractionHierarchy.h"
+#include "Parallel.h"
+#include "PathLength.h"
+#include "Serialization.h"
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <queue>
+#include <stdexcept>
+#include <utility>
+
+namespace {
+
+const int INF = std::numeric_limits<int>::max();
+const char MAGIC[4] = { 'G', 'T', 'C', 'H' };
+const std::uint32_t FORMAT_VERSION = 1;
+
+// Witness searches give up after settling this many vertices and keep the shortcut instead.
+const size_t WITNESS_SETTLE_LIMIT = 1000;
+
+using PQEntry = std::pair<int, int>;
+using MinHeap = std::priority_queue<PQEntry, std::vector<PQEntry>, std::greater<PQEntry>>;
+
+struct Arc {
+    int other;
+    int weight;
+    int middle;
+};
+
+struct Shortcut {
+    int from;
+    int to;
+    int weight;
+    int middle;
+};
+
+/**
+ * Inserts an arc, or lowers the weight of an existing arc to the same vertex.
+ * Returns true if a new arc was inserted.
+ */
+bool addOrImproveArc(std::vector<Arc>& arcs, int other, int weight, int middle)
+{
+    for (Arc& arc : arcs) {
+        if (arc.other == other) {
+            if (weight < arc.weight) {
+                arc.weight = weight;
+                arc.middle = middle;
+            }
+            return false;
+        }
+    }
+    arcs.push_back({ other, weight, middle });
+    return true;
+}
+
+/**
+ * Per-thread Dijkstra scratch for witness searches; only touched entries are reset between runs.
+ */
+class WitnessSearch {
+private:
+    std::vector<int> dist;
+    std::vector<int> touched;
+
+public:
+    explicit WitnessSearch(size_t vertices)
+        : dist(vertices, INF)
+    {
+    }
+
+    /**
+     * Computes distances from source over non-contracted vertices other than avoid, settling
+     * nothing farther than maxDistance. Unsettled entries remain valid upper bounds.
+     */
+    void run(const std::vector<std::vector<Arc>>& out, const std::vector<bool>& contracted,
+        int source, int avoid, int maxDistance)
+    {
+        for (int v : touched)
+            dist[static_cast<size_t>(v)] = INF;
+        touched.clear();
+
+        MinHeap pq;
+        dist[static_cast<size_t>(source)] = 0;
+        touched.push_back(source);
+        pq.push({ 0, source });
+
+        size_t settled = 0;
+        while (!pq.empty()) {
+            auto [d, u] = pq.top();
+            pq.pop();
+
+            if (d > dist[static_cast<size_t>(u)])
+                continue;
+            if (d > maxDistance || ++settled > WITNESS_SETTLE_LIMIT)
+                break;
+
+            for (const Arc& arc : out[static_cast<size_t>(u)]) {
+                size_t x = static_cast<size_t>(arc.other);
+                // Paths beyond maxDistance are never needed, so the sum below cannot overflow.
+                if (contracted[x] || arc.other == avoid || arc.weight > maxDistance - d)
+                    continue;
+                if (d + arc.weight < dist[x]) {
+                    if (dist[x] == INF)
+                        touched.push_back(arc.other);
+                    dist[x] = d + arc.weight;
+                    pq.push({ dist[x], arc.other });
+                }
+            }
+        }
+    }
+
+    int distanceTo(int vertex) const
+    {
+        return dist[static_cast<size_t>(vertex)];
+    }
+};
+
+/**
+ * Lists the shortcuts needed to contract v: one per in/out neighbor pair whose path through v
+ * has no witness of equal or shorter length.
+ */
+std::vector<Shortcut> findShortcuts(const std::vector<std::vector<Arc>>& out,
+    const std::vector<std::vector<Arc>>& in, const std::vector<bool>& contracted, int v,
+    WitnessSearch& search)
+{
+    std::vector<Shortcut> shortcuts;
+    const std::vector<Arc>& outArcs = out[static_cast<size_t>(v)];
+
+    int maxOut = 0;
+    for (const Arc& arc : outArcs)
+        if (!contracted[static_cast<size_t>(arc.other)])
+            maxOut = std::max(maxOut, arc.weight);
+
+    for (const Arc& inArc : in[static_cast<size_t>(v)]) {
+        int u = inArc.other;
+        if (contracted[static_cast<size_t>(u)])
+            continue;
+
+        // The bound saturates; a shortcut that does not fit an int is rejected below.
+        int bound = maxOut >= INF - inArc.weight ? INF - 1 : inArc.weight + maxOut;
+        search.run(out, contracted, u, v, bound);
+
+        for (const Arc& outArc : outArcs) {
+            int x = outArc.other;
+            if (x == u || contracted[static_cast<size_t>(x)])
+                continue;
+            long long via = static_cast<long long>(inArc.weight) + outArc.weight;
+            int witness = search.distanceTo(x);
+            if (witness == INF || witness > via)
+                shortcuts.push_back({ u, x, extend(inArc.weight, outArc.weight), v });
+        }
+    }
+    return shortcuts;
+}
+
+/**
+ * Thread-local scratch for queries. Entries touched by a query are reset afterwards, so a query
+ * costs time proportional to its search space rather than to the number of vertices.
+ */
+struct QueryScratch {
+    std::vector<int> distForward;
+    std::vector<int> distBackward;
+    std::vector<int> parentForward; // previous vertex on the forward search tree
+    std::vector<int> parentBackward; // next vertex on the backward search tree
+    std::vector<size_t> edgeForward; // edge id used to reach the vertex
+    std::vector<size_t> edgeBackward;
+    std::vector<int> touched;
+
+    void prepare(size_t vertices)
+    {
+        if (distForward.size() < vertices) {
+            distForward.resize(vertices, INF);
+            distBackward.resize(vertices, INF);
+            parentForward.resize(vertices, -1);
+            parentBackward.resize(vertices, -1);
+            edgeForward.resize(vertices, 0);
+            edgeBackward.resize(vertices, 0);
+        }
+    }
+
+    void reset()
+    {
+        for (int v : touched) {
+            distForward[static_cast<size_t>(v)] = INF;
+            distBackward[static_cast<size_t>(v)] = INF;
+            parentForward[static_cast<size_t>(v)] = -1;
+            parentBackward[static_cast<size_t>(v)] = -1;
+        }
+        touched.clear();
+    }
+};
+
+void writeSearchGraph(std::ostream& out, const CsrGraph& graph, const std::vector<int>& middle)
+{
+    writeValue<std::uint64_t>(out, graph.getNumEdges());
+    for (const CsrGraph::Edge& edge : graph.getEdges()) {
+        writeValue<std::int32_t>(out, edge.from);
+        writeValue<std::int32_t>(out, edge.to);
+        writeValue<std::int32_t>(out, edge.weight);
+    }
+    writeInts(out, middle);
+}
+
+CsrGraph readSearchGraph(std::istream& in, size_t vertices, std::vector<int>& middle)
+{
+    size_t numEdges = readValue<std::uint64_t>(in);
+    std::vector<CsrGraph::Edge> edges;
+    for (size_t e = 0; e < numEdges; ++e) {
+        int from = readValue<std::int32_t>(in);
+        int to = readValue<std::int32_t>(in);
+        int weight = readValue<std::int32_t>(in);
+        edges.push_back({ from, to, weight });
+    }
+    middle = readInts(in, numEdges);
+
+    try {
+        return CsrGraph(vertices, edges);
+    } catch (const std::out_of_range&) {
+        throw std::runtime_error("Contraction hierarchy contains an invalid edge.");
+    }
+}
+
+} // namespace
+
+ContractionHierarchy::ContractionHierarchy()
+    : numVertices(0)
+    , numShortcuts(0)
+{
+}
+
+ContractionHierarchy::ContractionHierarchy(const Graph& graph, size_t numThreads)
+    : numVertices(graph.getNumVertices())
+    , numShortcuts(0)
+    , rank(numVertices, -1)
+{
+    size_t n = numVertices;
+    std::vector<std::vector<Arc>> out(n);
+    std::vector<std::vector<Arc>> in(n);
+
+    for (size_t u = 0; u < n; ++u) {
+        std::vector<int> neighbors = graph.getNeighbors(u);
+        for (int v : neighbors) {
+            int weight = graph.getEdgeWeight(u, static_cast<size_t>(v));
+            if (weight < 0)
+                throw std::invalid_argument("Graph contains negative edge weights.");
+            // Self-loops never lie on a shortest path.
+            if (static_cast<size_t>(v) == u)
+                continue;
+            out[u].push_back({ v, weight, -1 });
+            in[static_cast<size_t>(v)].push_back({ static_cast<int>(u), weight, -1 });
+        }
+    }
+
+    size_t threads = resolveThreadCount(numThreads, n);
+    std::vector<WitnessSearch> searches(threads, WitnessSearch(n));
+    std::vector<bool> contracted(n, false);
+    std::vector<int> contractedNeighbors(n, 0);
+    std::vector<int> priority(n, 0);
+
+    // Edge difference: shortcuts added minus edges removed, plus already-contracted neighbors to
+    // spread contraction uniformly over the graph.
+    auto updatePriorities = [&](const std::vector<int>& vertices) {
+        parallelFor(vertices.size(), threads, [&](size_t worker, size_t i) {
+            int v = vertices[i];
+            int removed = 0;
+            for (const Arc& arc : out[static_cast<size_t>(v)])
+                removed += contracted[static_cast<size_t>(arc.other)] ? 0 : 1;
+            for (const Arc& arc : in[static_cast<size_t>(v)])
+                removed += contracted[static_cast<size_t>(arc.other)] ? 0 : 1;
+
+            int added = static_cast<int>(
+                findShortcuts(out, in, contracted, v, searches[worker]).size());
+            priority[static_cast<size_t>(v)]
+                = added - removed + contractedNeighbors[static_cast<size_t>(v)];
+        });
+    };
+
+    auto contractsBefore = [&priority](int a, int b) {
+        size_t i = static_cast<size_t>(a);
+        size_t j = static_cast<size_t>(b);
+        return priority[i] < priority[j] || (priority[i] == priority[j] && a < b);
+    };
+
+    std::vector<int> remaining(n);
+    std::iota(remaining.begin(), remaining.end(), 0);
+    updatePriorities(remaining);
+
+    int nextRank = 0;
+    while (!remaining.empty()) {
+        // Contract every vertex whose priority is a strict local minimum. No two such vertices
+        // are adjacent, so their shortcuts can be computed independently.
+        std::vector<int> batch;
+        for (int v : remaining) {
+            bool isMinimum = true;
+            for (const Arc& arc : out[static_cast<size_t>(v)])
+                if (!contracted[static_cast<size_t>(arc.other)] && contractsBefore(arc.other, v))
+                    isMinimum = false;
+            for (const Arc& arc : in[static_cast<size_t>(v)])
+                if (!contracted[static_cast<size_t>(arc.other)] && contractsBefore(arc.other, v))
+                    isMinimum = false;
+            if (isMinimum)
+                batch.push_back(v);
+        }
+
+        // Marking the whole batch contracted first keeps witness paths from running through
+        // vertices that are being removed in the same round.
+        for (int v : batch)
+            contracted[static_cast<size_t>(v)] = true;
+
+        std::vector<std::vector<Shortcut>> found(batch.size());
+        parallelFor(batch.size(), threads, [&](size_t worker, size_t i) {
+            found[i] = findShortcuts(out, in, contracted, batch[i], searches[worker]);
+        });
+
+        std::vector<int> affected;
+        std::vector<bool> isAffected(n, false);
+        for (size_t i = 0; i < batch.size(); ++i) {
+            size_t v = static_cast<size_t>(batch[i]);
+            rank[v] = nextRank++;
+
+            for (const Shortcut& shortcut : found[i]) {
+                if (addOrImproveArc(out[static_cast<size_t>(shortcut.from)], shortcut.to,
+                        shortcut.weight, shortcut.middle))
+                    ++numShortcuts;
+                addOrImproveArc(in[static_cast<size_t>(shortcut.to)], shortcut.from,
+                    shortcut.weight, shortcut.middle);
+            }
+
+            for (const std::vector<Arc>* arcs : { &out[v], &in[v] }) {
+                for (const Arc& arc : *arcs) {
+                    size_t other = static_cast<size_t>(arc.other);
+                    if (contracted[other])
+                        continue;
+                    ++contractedNeighbors[other];
+                    if (!isAffected[other]) {
+                        isAffected[other] = true;
+                        affected.push_back(arc.other);
+                    }
+                }
+            }
+        }
+
+        std::erase_if(
+            remaining, [&contracted](int v) { return contracted[static_cast<size_t>(v)]; });
+        updatePriorities(affected);
+    }
+
+    // Split every arc by rank: upward arcs are searched from the source, the rest are reversed so
+    // the backward search from the target also only climbs the hierarchy.
+    std::vector<CsrGraph::Edge> upEdges;
+    std::vector<std::pair<CsrGraph::Edge, int>> downEdges;
+    for (size_t u = 0; u < n; ++u) {
+        for (const Arc& arc : out[u]) {
+            if (rank[u] < rank[static_cast<size_t>(arc.other)]) {
+                upEdges.push_back({ static_cast<int>(u), arc.other, arc.weight });
+                upwardMiddle.push_back(arc.middle);
+            } else {
+                downEdges.push_back({ { arc.other, static_cast<int>(u), arc.weight }, arc.middle });
+            }
+        }
+    }
+
+    std::stable_sort(downEdges.begin(), downEdges.end(),
+        [](const auto& a, const auto& b) { return a.first.from < b.first.from; });
+    std::vector<CsrGraph::Edge> downList;
+    for (const auto& [edge, middle] : downEdges) {
+        downList.push_back(edge);
+        downwardMiddle.push_back(middle);
+    }
+
+    upward = CsrGraph(n, upEdges);
+    downward = CsrGraph(n, downList);
+}
+
+int ContractionHierarchy::query(size_t source, size_t target, std::vector<int>* path) const
+{
+    if (source == target) {
+        if (path)
+            *path = { static_cast<int>(source) };
+        return 0;
+    }
+
+    thread_local QueryScratch scratch;
+    scratch.prepare(numVertices);
+
+    MinHeap forwardQueue;
+    MinHeap backwardQueue;
+    scratch.distForward[source] = 0;
+    scratch.distBackward[target] = 0;
+    scratch.touched.push_back(static_cast<int>(source));
+    scratch.touched.push_back(static_cast<int>(target));
+    forwardQueue.push({ 0, static_cast<int>(source) });
+    backwardQueue.push({ 0, static_cast<int>(target) });
+
+    int best = INF;
+    int meeting = -1;
+
+    while (true) {
+        int forwardKey = forwardQueue.empty() ? INF : forwardQueue.top().first;
+        int backwardKey = backwardQueue.empty() ? INF : backwardQueue.top().first;
+        if (std::min(forwardKey, backwardKey) >= best)
+            break;
+
+        bool forward = forwardKey <= backwardKey;
+        MinHeap& queue = forward ? forwardQueue : backwardQueue;
+        const CsrGraph& searchGraph = forward ? upward : downward;
+        std::vector<int>& dist = forward ? scratch.distForward : scratch.distBackward;
+        std::vector<int>& otherDist = forward ? scratch.distBackward : scratch.distForward;
+        std::vector<int>& parent = forward ? scratch.parentForward : scratch.parentBackward;
+        std::vector<size_t>& parentEdge = forward ? scratch.edgeForward : scratch.edgeBackward;
+
+        auto [d, u] = queue.top();
+        queue.pop();
+        size_t current = static_cast<size_t>(u);
+
+        if (d > dist[current])
+            continue;
+
+        if (otherDist[current] != INF && extend(d, otherDist[current]) < best) {
+            best = d + otherDist[current];
+            meeting = u;
+        }
+
+        std::span<const int> neighbors = searchGraph.getNeighbors(current);
+        std::span<const int> weights = searchGraph.getWeights(current);
+        size_t firstEdge = searchGraph.edgeBegin(current);
+        for (size_t i = 0; i < neighbors.size(); ++i) {
+            size_t v = static_cast<size_t>(neighbors[i]);
+            int candidate = extend(d, weights[i]);
+            if (candidate < dist[v]) {
+                if (dist[v] == INF && otherDist[v] == INF)
+                    scratch.touched.push_back(neighbors[i]);
+                dist[v] = candidate;
+                parent[v] = u;
+                parentEdge[v] = firstEdge + i;
+                queue.push({ dist[v], neighbors[i] });
+            }
+        }
+    }
+
+    if (path && best != INF) {
+        std::vector<std::pair<int, size_t>> forwardEdges; // {tail, upward edge id}
+        for (int v = meeting; scratch.parentForward[static_cast<size_t>(v)] != -1;
+             v = scratch.parentForward[static_cast<size_t>(v)])
+            forwardEdges.push_back({ v, scratch.edgeForward[static_cast<size_t>(v)] });
+
+        path->assign(1, static_cast<int>(source));
+        for (size_t i = forwardEdges.size(); i-- > 0;) {
+            int head = forwardEdges[i].first;
+            int tail = scratch.parentForward[static_cast<size_t>(head)];
+            unpackEdge(tail, head, upwardMiddle[forwardEdges[i].second], *path);
+        }
+        for (int v = meeting; scratch.parentBackward[static_cast<size_t>(v)] != -1;
+             v = scratch.parentBackward[static_cast<size_t>(v)]) {
+            int next = scratch.parentBackward[static_cast<size_t>(v)];
+            size_t edge = scratch.edgeBackward[static_cast<size_t>(v)];
+            unpackEdge(v, next, downwardMiddle[edge], *path);
+        }
+    }
+
+    scratch.reset();
+    return best;
+}
+
+void ContractionHierarchy::unpackEdge(int from, int to, int middle, std::vector<int>& path) const
+{
+    // Shortcut from -> to via m stands for from -> m (stored downward at m, since m ranks lower)
+    // followed by m -> to (stored upward at m). Unpack depth-first without recursion.
+    std::vector<Shortcut> pending = { { from, to, 0, middle } };
+    while (!pending.empty()) {
+        Shortcut edge = pending.back();
+        pending.pop_back();
+
+        if (edge.middle == -1) {
+            path.push_back(edge.to);
+            continue;
+        }
+
+        size_t m = static_cast<size_t>(edge.middle);
+        int firstMiddle = -1;
+        int secondMiddle = -1;
+
+        std::span<const int> down = downward.getNeighbors(m);
+        for (size_t i = 0; i < down.size(); ++i)
+            if (down[i] == edge.from)
+                firstMiddle = downwardMiddle[downward.edgeBegin(m) + i];
+
+        std::span<const int> up = upward.getNeighbors(m);
+        for (size_t i = 0; i < up.size(); ++i)
+            if (up[i] == edge.to)
+                secondMiddle = upwardMiddle[upward.edgeBegin(m) + i];
+
+        pending.push_back({ edge.middle, edge.to, 0, secondMiddle });
+        pending.push_back({ edge.from, edge.middle, 0, firstMiddle });
+    }
+}
+
+size_t ContractionHierarchy::getNumVertices() const
+{
+    return numVertices;
+}
+
+size_t ContractionHierarchy::getNumShortcuts() const
+{
+    return numShortcuts;
+}
+
+int ContractionHierarchy::getRank(size_t vertex) const
+{
+    if (vertex >= numVertices)
+        throw std::out_of_range("This index is out of range.");
+
+    return rank[vertex];
+}
+
+int ContractionHierarchy::distance(size_t source, size_t target) const
+{
+    if (source >= numVertices || target >= numVertices)
+        throw std::out_of_range("One of these indices is out of range.");
+
+    return query(source, target, nullptr);
+}
+
+std::vector<int> ContractionHierarchy::shortestPath(size_t source, size_t target) const
+{
+    if (source >= numVertices || target >= numVertices)
+        throw std::out_of_range("One of these indices is out of range.");
+
+    std::vector<int> path;
+    query(source, target, &path);
+    return path;
+}
+
+void ContractionHierarchy::save(std::ostream& out) const
+{
+    out.write(MAGIC, sizeof(MAGIC));
+    writeValue<std::uint32_t>(out, FORMAT_VERSION);
+    writeValue<std::uint64_t>(out, numVertices);
+    writeValue<std::uint64_t>(out, numShortcuts);
+    writeInts(out, rank);
+    writeSearchGraph(out, upward, upwardMiddle);
+    writeSearchGraph(out, downward, downwardMiddle);
+
+    if (!out)
+        throw std::runtime_error("Failed to write contraction hierarchy.");
+}
+
+ContractionHierarchy ContractionHierarchy::load(std::istream& in)
+{
+    char magic[sizeof(MAGIC)];
+    if (!in.read(magic, sizeof(magic)) || !std::equal(magic, magic + sizeof(magic), MAGIC))
+        throw std::runtime_error("Stream does not contain a contraction hierarchy.");
+    if (readValue<std::uint32_t>(in) != FORMAT_VERSION)
+        throw std::runtime_error("Unsupported contraction hierarchy version.");
+
+    ContractionHierarchy hierarchy;
+    hierarchy.numVertices = readVertexCount(in);
+    hierarchy.numShortcuts = readValue<std::uint64_t>(in);
+    hierarchy.rank = readInts(in, hierarchy.numVertices);
+    hierarchy.upward = readSearchGraph(in, hierarchy.numVertices, hierarchy.upwardMiddle);
+    hierarchy.downward = readSearchGraph(in, hierarchy.numVertices, hierarchy.downwardMiddle);
+    if (hierarchy.numShortcuts > hierarchy.upward.getNumEdges() + hierarchy.downward.getNumEdges())
+        throw std::runtime_error("Contraction hierarchy has more shortcuts than edges.");
+
+    return hierarchy;
+}
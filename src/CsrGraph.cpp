@@ -0,0 +1,128 @@
+#include "CsrGraph.h"
+#include <stdexcept>
+#include <utility>
+
+bool CsrGraph::validVertex(size_t vertex) const noexcept
+{
+    return vertex < numVertices;
+}
+
+CsrGraph::CsrGraph()
+    : numVertices(0)
+    , offsets(1, 0)
+    , negativeWeights(false)
+{
+}
+
+CsrGraph::CsrGraph(const Graph& graph)
+    : numVertices(graph.getNumVertices())
+    , negativeWeights(false)
+{
+    offsets.reserve(numVertices + 1);
+    offsets.push_back(0);
+
+    for (size_t u = 0; u < numVertices; ++u) {
+        std::vector<int> neighbors = graph.getNeighbors(u);
+        for (int v : neighbors) {
+            targets.push_back(v);
+            weights.push_back(graph.getEdgeWeight(u, static_cast<size_t>(v)));
+            negativeWeights = negativeWeights || weights.back() < 0;
+        }
+        offsets.push_back(targets.size());
+    }
+}
+
+CsrGraph::CsrGraph(size_t vertices, const std::vector<Edge>& edges)
+    : numVertices(vertices)
+    , offsets(vertices + 1, 0)
+    , targets(edges.size())
+    , weights(edges.size())
+    , negativeWeights(false)
+{
+    // Counting sort by source keeps the input order of each vertex's edges.
+    for (const Edge& edge : edges) {
+        if (edge.from < 0 || edge.to < 0 || !validVertex(static_cast<size_t>(edge.from))
+            || !validVertex(static_cast<size_t>(edge.to)))
+            throw std::out_of_range("Edge endpoint is out of range.");
+        ++offsets[static_cast<size_t>(edge.from) + 1];
+    }
+
+    for (size_t v = 0; v < numVertices; ++v)
+        offsets[v + 1] += offsets[v];
+
+    std::vector<size_t> next(offsets.begin(), offsets.end() - 1);
+    for (const Edge& edge : edges) {
+        size_t slot = next[static_cast<size_t>(edge.from)]++;
+        targets[slot] = edge.to;
+        weights[slot] = edge.weight;
+        negativeWeights = negativeWeights || edge.weight < 0;
+    }
+}
+
+size_t CsrGraph::getNumVertices() const
+{
+    return numVertices;
+}
+
+size_t CsrGraph::getNumEdges() const
+{
+    return targets.size();
+}
+
+bool CsrGraph::hasNegativeWeights() const
+{
+    return negativeWeights;
+}
+
+size_t CsrGraph::edgeBegin(size_t vertex) const
+{
+    if (!validVertex(vertex))
+        throw std::out_of_range("This index is out of range.");
+
+    return offsets[vertex];
+}
+
+size_t CsrGraph::edgeEnd(size_t vertex) const
+{
+    if (!validVertex(vertex))
+        throw std::out_of_range("This index is out of range.");
+
+    return offsets[vertex + 1];
+}
+
+std::span<const int> CsrGraph::getNeighbors(size_t vertex) const
+{
+    if (!validVertex(vertex))
+        throw std::out_of_range("This index is out of range.");
+
+    return { targets.data() + offsets[vertex], offsets[vertex + 1] - offsets[vertex] };
+}
+
+std::span<const int> CsrGraph::getWeights(size_t vertex) const
+{
+    if (!validVertex(vertex))
+        throw std::out_of_range("This index is out of range.");
+
+    return { weights.data() + offsets[vertex], offsets[vertex + 1] - offsets[vertex] };
+}
+
+std::vector<CsrGraph::Edge> CsrGraph::getEdges() const
+{
+    std::vector<Edge> edges;
+    edges.reserve(targets.size());
+
+    for (size_t u = 0; u < numVertices; ++u)
+        for (size_t e = offsets[u]; e < offsets[u + 1]; ++e)
+            edges.push_back({ static_cast<int>(u), targets[e], weights[e] });
+
+    return edges;
+}
+
+CsrGraph CsrGraph::transpose() const
+{
+    std::vector<Edge> reversed = getEdges();
+    for (Edge& edge : reversed)
+        std::swap(edge.from, edge.to);
+
+    return CsrGraph(numVertices, reversed);
+}
@@ -0,0 +1,118 @@
+#include "DistanceMatrix.h"
+#include <limits>
+#include <stdexcept>
+
+namespace {
+
+const int INF = std::numeric_limits<int>::max();
+
+// INT16_MAX is reserved as the unreachable marker of 16-bit storage.
+const std::int16_t NARROW_INF = std::numeric_limits<std::int16_t>::max();
+
+} // namespace
+
+DistanceMatrix::DistanceMatrix()
+    : DistanceMatrix(0)
+{
+}
+
+DistanceMatrix::DistanceMatrix(size_t vertices, MatrixLayout layout, DistanceWidth width)
+    : numVertices(vertices)
+    , layout(layout)
+    , width(width)
+    , blocksPerRow((vertices + BLOCK_SIZE - 1) / BLOCK_SIZE)
+{
+    size_t side = layout == MatrixLayout::Blocked ? blocksPerRow * BLOCK_SIZE : numVertices;
+    if (width == DistanceWidth::Int32)
+        wide.assign(side * side, INF);
+    else
+        narrow.assign(side * side, NARROW_INF);
+}
+
+size_t DistanceMatrix::offset(size_t from, size_t to) const noexcept
+{
+    if (layout == MatrixLayout::RowMajor)
+        return from * numVertices + to;
+
+    size_t tile = (from / BLOCK_SIZE) * blocksPerRow + to / BLOCK_SIZE;
+    return tile * BLOCK_SIZE * BLOCK_SIZE + (from % BLOCK_SIZE) * BLOCK_SIZE + to % BLOCK_SIZE;
+}
+
+size_t DistanceMatrix::getNumVertices() const
+{
+    return numVertices;
+}
+
+MatrixLayout DistanceMatrix::getLayout() const
+{
+    return layout;
+}
+
+DistanceWidth DistanceMatrix::getWidth() const
+{
+    return width;
+}
+
+size_t DistanceMatrix::getMemoryUsage() const
+{
+    return wide.size() * sizeof(std::int32_t) + narrow.size() * sizeof(std::int16_t);
+}
+
+int DistanceMatrix::get(size_t from, size_t to) const
+{
+    if (from >= numVertices || to >= numVertices)
+        throw std::out_of_range("One of these indices is out of range.");
+
+    if (width == DistanceWidth::Int32)
+        return wide[offset(from, to)];
+
+    std::int16_t value = narrow[offset(from, to)];
+    return value == NARROW_INF ? INF : value;
+}
+
+void DistanceMatrix::set(size_t from, size_t to, int distance)
+{
+    if (from >= numVertices || to >= numVertices)
+        throw std::out_of_range("One of these indices is out of range.");
+
+    if (width == DistanceWidth::Int32) {
+        wide[offset(from, to)] = distance;
+        return;
+    }
+
+    if (distance == INF) {
+        narrow[offset(from, to)] = NARROW_INF;
+        return;
+    }
+    if (distance < std::numeric_limits<std::int16_t>::min() || distance >= NARROW_INF)
+        throw std::overflow_error("Distance does not fit in 16 bits.");
+    narrow[offset(from, to)] = static_cast<std::int16_t>(distance);
+}
+
+size_t DistanceMatrix::getNumBlocks() const
+{
+    return blocksPerRow;
+}
+
+std::span<std::int32_t> DistanceMatrix::getTile(size_t blockRow, size_t blockColumn)
+{
+    if (layout != MatrixLayout::Blocked || width != DistanceWidth::Int32)
+        throw std::logic_error("Tiles require a blocked matrix with 32-bit entries.");
+    if (blockRow >= blocksPerRow || blockColumn >= blocksPerRow)
+        throw std::out_of_range("One of these indices is out of range.");
+
+    size_t tileSize = BLOCK_SIZE * BLOCK_SIZE;
+    return { wide.data() + (blockRow * blocksPerRow + blockColumn) * tileSize, tileSize };
+}
+
+std::vector<int> DistanceMatrix::getRow(size_t from) const
+{
+    if (from >= numVertices)
+        throw std::out_of_range("This index is out of range.");
+
+    std::vector<int> row(numVertices);
+    for (size_t to = 0; to < numVertices; ++to)
+        row[to] = get(from, to);
+
+    return row;
+}
@@ -0,0 +1,249 @@
+#include "DynamicShortestPaths.h"
+#include "PathLength.h"
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <stdexcept>
+#include <tuple>
+
+namespace {
+
+const int INF = std::numeric_limits<int>::max();
+
+using HeapEntry = std::pair<int, int>;
+
+/**
+ * Finds the arc to a given vertex in an adjacency list, or returns end.
+ */
+template <typename Arcs> auto findArc(Arcs& arcs, int other)
+{
+    return std::find_if(
+        arcs.begin(), arcs.end(), [other](const auto& arc) { return arc.other == other; });
+}
+
+} // namespace
+
+DynamicShortestPaths::DynamicShortestPaths(const Graph& graph, size_t source)
+    : DynamicShortestPaths(CsrGraph(graph), source)
+{
+}
+
+DynamicShortestPaths::DynamicShortestPaths(const CsrGraph& graph, size_t source)
+    : source(source)
+    , generation(0)
+    , lastRepairSize(0)
+{
+    if (source >= graph.getNumVertices())
+        throw std::out_of_range("This index is out of range.");
+    if (graph.hasNegativeWeights())
+        throw std::invalid_argument("Graph contains negative edge weights.");
+
+    initialize(graph.getNumVertices(), graph.getEdges());
+}
+
+bool DynamicShortestPaths::validVertex(size_t vertex) const noexcept
+{
+    return vertex < dist.size();
+}
+
+void DynamicShortestPaths::initialize(size_t vertices, const std::vector<CsrGraph::Edge>& edges)
+{
+    out.assign(vertices, {});
+    in.assign(vertices, {});
+    dist.assign(vertices, INF);
+    pred.assign(vertices, -1);
+    affectedStamp.assign(vertices, 0);
+    generation = 0;
+
+    // Sorting puts the lightest of each group of parallel edges first, so the rest can be skipped.
+    std::vector<CsrGraph::Edge> sorted = edges;
+    std::sort(sorted.begin(), sorted.end(), [](const CsrGraph::Edge& a, const CsrGraph::Edge& b) {
+        return std::tie(a.from, a.to, a.weight) < std::tie(b.from, b.to, b.weight);
+    });
+    for (size_t i = 0; i < sorted.size(); ++i) {
+        const CsrGraph::Edge& edge = sorted[i];
+        if (i > 0 && sorted[i - 1].from == edge.from && sorted[i - 1].to == edge.to)
+            continue;
+        out[static_cast<size_t>(edge.from)].push_back({ edge.to, edge.weight });
+        in[static_cast<size_t>(edge.to)].push_back({ edge.from, edge.weight });
+    }
+
+    dist[source] = 0;
+    std::vector<HeapEntry> heap { { 0, static_cast<int>(source) } };
+    settle(heap);
+}
+
+size_t DynamicShortestPaths::settle(std::vector<HeapEntry>& heap)
+{
+    size_t settled = 0;
+    std::make_heap(heap.begin(), heap.end(), std::greater<HeapEntry>());
+    while (!heap.empty()) {
+        std::pop_heap(heap.begin(), heap.end(), std::greater<HeapEntry>());
+        auto [length, vertex] = heap.back();
+        heap.pop_back();
+        if (length != dist[static_cast<size_t>(vertex)])
+            continue;
+
+        ++settled;
+        for (const Arc& arc : out[static_cast<size_t>(vertex)]) {
+            int candidate = extend(length, arc.weight);
+            size_t next = static_cast<size_t>(arc.other);
+            if (candidate < dist[next]) {
+                dist[next] = candidate;
+                pred[next] = vertex;
+                heap.push_back({ candidate, arc.other });
+                std::push_heap(heap.begin(), heap.end(), std::greater<HeapEntry>());
+            }
+        }
+    }
+
+    return settled;
+}
+
+void DynamicShortestPaths::repairSubtree(size_t root)
+{
+    // Stamps from earlier repairs become stale; only a wrap-around clears them.
+    if (++generation == 0) {
+        std::fill(affectedStamp.begin(), affectedStamp.end(), 0);
+        generation = 1;
+    }
+    auto affected = [this](size_t vertex) { return affectedStamp[vertex] == generation; };
+
+    // Every vertex whose tree path runs through root may have become farther away.
+    std::vector<int> subtree { static_cast<int>(root) };
+    affectedStamp[root] = generation;
+    for (size_t i = 0; i < subtree.size(); ++i) {
+        int vertex = subtree[i];
+        for (const Arc& arc : out[static_cast<size_t>(vertex)]) {
+            size_t next = static_cast<size_t>(arc.other);
+            if (pred[next] == vertex && !affected(next)) {
+                affectedStamp[next] = generation;
+                subtree.push_back(arc.other);
+            }
+        }
+    }
+
+    for (int vertex : subtree) {
+        dist[static_cast<size_t>(vertex)] = INF;
+        pred[static_cast<size_t>(vertex)] = -1;
+    }
+
+    // Distances outside the subtree are still exact, so they seed the affected region.
+    std::vector<HeapEntry> heap;
+    for (int vertex : subtree) {
+        size_t v = static_cast<size_t>(vertex);
+        for (const Arc& arc : in[v]) {
+            size_t from = static_cast<size_t>(arc.other);
+            if (affected(from) || dist[from] == INF)
+                continue;
+            int candidate = extend(dist[from], arc.weight);
+            if (candidate < dist[v]) {
+                dist[v] = candidate;
+                pred[v] = arc.other;
+            }
+        }
+        if (dist[v] != INF)
+            heap.push_back({ dist[v], vertex });
+    }
+
+    // Affected distances only grow, so settling never improves a vertex outside the subtree.
+    settle(heap);
+    lastRepairSize = subtree.size();
+}
+
+size_t DynamicShortestPaths::getNumVertices() const
+{
+    return dist.size();
+}
+
+size_t DynamicShortestPaths::getSource() const
+{
+    return source;
+}
+
+int DynamicShortestPaths::getDistance(size_t vertex) const
+{
+    if (!validVertex(vertex))
+        throw std::out_of_range("This index is out of range.");
+
+    return dist[vertex];
+}
+
+int DynamicShortestPaths::getPredecessor(size_t vertex) const
+{
+    if (!validVertex(vertex))
+        throw std::out_of_range("This index is out of range.");
+
+    return pred[vertex];
+}
+
+const std::vector<int>& DynamicShortestPaths::distances() const
+{
+    return dist;
+}
+
+const std::vector<int>& DynamicShortestPaths::predecessors() const
+{
+    return pred;
+}
+
+size_t DynamicShortestPaths::getLastRepairSize() const
+{
+    return lastRepairSize;
+}
+
+void DynamicShortestPaths::addEdge(size_t from, size_t to, int weight)
+{
+    if (!validVertex(from) || !validVertex(to))
+        throw std::out_of_range("One of these indices is out of range.");
+    if (weight < 0)
+        throw std::invalid_argument("Weight cannot be negative.");
+
+    lastRepairSize = 0;
+    int head = static_cast<int>(to);
+    int tail = static_cast<int>(from);
+    auto outArc = findArc(out[from], head);
+    bool heavier = false;
+    if (outArc == out[from].end()) {
+        out[from].push_back({ head, weight });
+        in[to].push_back({ tail, weight });
+    } else {
+        heavier = weight > outArc->weight;
+        outArc->weight = weight;
+        findArc(in[to], tail)->weight = weight;
+    }
+
+    if (heavier) {
+        if (pred[to] == tail)
+            repairSubtree(to);
+        return;
+    }
+
+    if (dist[from] == INF)
+        return;
+    int candidate = extend(dist[from], weight);
+    if (candidate >= dist[to])
+        return;
+
+    // Only vertices whose distance improves are settled again.
+    dist[to] = candidate;
+    pred[to] = tail;
+    std::vector<HeapEntry> heap { { candidate, head } };
+    lastRepairSize = settle(heap);
+}
+
+void DynamicShortestPaths::removeEdge(size_t from, size_t to)
+{
+    if (!validVertex(from) || !validVertex(to))
+        throw std::out_of_range("One of these indices is out of range.");
+
+    lastRepairSize = 0;
+    auto outArc = findArc(out[from], static_cast<int>(to));
+    if (outArc == out[from].end())
+        return;
+
+    out[from].erase(outArc);
+    in[to].erase(findArc(in[to], static_cast<int>(from)));
+    if (pred[to] == static_cast<int>(from))
+        repairSubtree(to);
+}
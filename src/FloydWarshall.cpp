@@ -0,0 +1,225 @@
+#include "Algorithms.h"
+#include "Parallel.h"
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+
+#if defined(__x86_64__) && defined(__GNUC__)
+#include <immintrin.h>
+#define GRAPH_TOOLKIT_X86_KERNELS
+#endif
+
+namespace {
+
+const int INF = std::numeric_limits<int>::max();
+
+// Finite distances must stay below TOO_FAR. A reachable pair whose distance would reach it is
+// saturated to TOO_FAR and reported as an overflow at the end, unless a shorter path replaces it.
+// Unreachable entries hold UNREACHED while the kernels run; the largest sum, TOO_FAR + UNREACHED,
+// is INT_MAX, so the kernels cannot overflow.
+const std::int32_t TOO_FAR = INF / 2;
+const std::int32_t UNREACHED = TOO_FAR + 1;
+
+const size_t B = DistanceMatrix::BLOCK_SIZE;
+
+/**
+ * Min-plus update of one tile: c[i][j] = min(c[i][j], a[i][k] + b[k][j]) for each k in order,
+ * where a holds c's rows in the pivot column block and b the pivot row block in c's columns.
+ * Sums are capped at max(b[k][j], TOO_FAR), which keeps unreachable entries UNREACHED and
+ * saturates long reachable ones at TOO_FAR.
+ * When pc is non-null, improved entries take their predecessor from pb[k][j]. c may alias a or b.
+ */
+using Kernel = void (*)(std::int32_t* c, const std::int32_t* a, const std::int32_t* b,
+    std::int32_t* pc, const std::int32_t* pb);
+
+void scalarKernel(std::int32_t* c, const std::int32_t* a, const std::int32_t* b, std::int32_t* pc,
+    const std::int32_t* pb)
+{
+    for (size_t k = 0; k < B; ++k) {
+        const std::int32_t* bRow = b + k * B;
+        for (size_t i = 0; i < B; ++i) {
+            std::int32_t aik = a[i * B + k];
+            if (aik == UNREACHED)
+                continue;
+
+            std::int32_t* cRow = c + i * B;
+            for (size_t j = 0; j < B; ++j) {
+                std::int32_t via = std::min(aik + bRow[j], std::max(bRow[j], TOO_FAR));
+                if (via < cRow[j]) {
+                    cRow[j] = via;
+                    if (pc)
+                        pc[i * B + j] = pb[k * B + j];
+                }
+            }
+        }
+    }
+}
+
+#ifdef GRAPH_TOOLKIT_X86_KERNELS
+
+__attribute__((target("avx2"))) void avx2Kernel(std::int32_t* c, const std::int32_t* a,
+    const std::int32_t* b, std::int32_t* pc, const std::int32_t* pb)
+{
+    for (size_t k = 0; k < B; ++k) {
+        const std::int32_t* bRow = b + k * B;
+        for (size_t i = 0; i < B; ++i) {
+            std::int32_t aik = a[i * B + k];
+            if (aik == UNREACHED)
+                continue;
+
+            __m256i broadcast = _mm256_set1_epi32(aik);
+            __m256i tooFar = _mm256_set1_epi32(TOO_FAR);
+            std::int32_t* cRow = c + i * B;
+            for (size_t j = 0; j < B; j += 8) {
+                __m256i current = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(cRow + j));
+                __m256i bkj = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(bRow + j));
+                __m256i via = _mm256_min_epi32(
+                    _mm256_add_epi32(broadcast, bkj), _mm256_max_epi32(bkj, tooFar));
+                _mm256_storeu_si256(
+                    reinterpret_cast<__m256i*>(cRow + j), _mm256_min_epi32(current, via));
+
+                if (pc) {
+                    __m256i improved = _mm256_cmpgt_epi32(current, via);
+                    __m256i* pcRow = reinterpret_cast<__m256i*>(pc + i * B + j);
+                    __m256i pbRow
+                        = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pb + k * B + j));
+                    _mm256_storeu_si256(pcRow,
+                        _mm256_blendv_epi8(_mm256_loadu_si256(pcRow), pbRow, improved));
+                }
+            }
+        }
+    }
+}
+
+__attribute__((target("avx512f"))) void avx512Kernel(std::int32_t* c, const std::int32_t* a,
+    const std::int32_t* b, std::int32_t* pc, const std::int32_t* pb)
+{
+    for (size_t k = 0; k < B; ++k) {
+        const std::int32_t* bRow = b + k * B;
+        for (size_t i = 0; i < B; ++i) {
+            std::int32_t aik = a[i * B + k];
+            if (aik == UNREACHED)
+                continue;
+
+            __m512i broadcast = _mm512_set1_epi32(aik);
+            __m512i tooFar = _mm512_set1_epi32(TOO_FAR);
+            std::int32_t* cRow = c + i * B;
+            for (size_t j = 0; j < B; j += 16) {
+                __m512i current = _mm512_loadu_si512(cRow + j);
+                __m512i bkj = _mm512_loadu_si512(bRow + j);
+                // Full-mask forms: GCC flags the undefined passthrough of the unmasked min/max.
+                __m512i cap = _mm512_mask_max_epi32(bkj, 0xFFFF, bkj, tooFar);
+                __m512i sum = _mm512_add_epi32(broadcast, bkj);
+                __m512i via = _mm512_mask_min_epi32(sum, 0xFFFF, sum, cap);
+                __mmask16 improved = _mm512_cmplt_epi32_mask(via, current);
+                _mm512_storeu_si512(cRow + j, _mm512_mask_mov_epi32(current, improved, via));
+
+                if (pc) {
+                    std::int32_t* pcRow = pc + i * B + j;
+                    __m512i pbRow = _mm512_loadu_si512(pb + k * B + j);
+                    _mm512_storeu_si512(
+                        pcRow, _mm512_mask_mov_epi32(_mm512_loadu_si512(pcRow), improved, pbRow));
+                }
+            }
+        }
+    }
+}
+
+#endif
+
+/**
+ * Picks the widest kernel the running CPU supports.
+ */
+Kernel selectKernel()
+{
+#ifdef GRAPH_TOOLKIT_X86_KERNELS
+    if (__builtin_cpu_supports("avx512f"))
+        return avx512Kernel;
+    if (__builtin_cpu_supports("avx2"))
+        return avx2Kernel;
+#endif
+    return scalarKernel;
+}
+
+} // namespace
+
+DistanceMatrix floydWarshall(const Graph& graph, std::vector<int>* predecessors, size_t numThreads)
+{
+    size_t n = graph.getNumVertices();
+    DistanceMatrix dist(n, MatrixLayout::Blocked);
+    size_t blocks = dist.getNumBlocks();
+
+    // Predecessor tiles mirror the distance tiles so the kernels can update both in lockstep.
+    std::vector<std::int32_t> pred(predecessors ? blocks * blocks * B * B : 0, -1);
+    auto predTile = [&](size_t row, size_t column) -> std::int32_t* {
+        return predecessors ? pred.data() + (row * blocks + column) * B * B : nullptr;
+    };
+    auto predAt = [&](size_t from, size_t to) -> std::int32_t& {
+        return predTile(from / B, to / B)[(from % B) * B + to % B];
+    };
+
+    for (size_t row = 0; row < blocks; ++row)
+        for (size_t column = 0; column < blocks; ++column)
+            for (std::int32_t& entry : dist.getTile(row, column))
+                entry = UNREACHED;
+
+    for (size_t u = 0; u < n; ++u) {
+        dist.set(u, u, 0);
+        for (int v : graph.getNeighbors(u)) {
+            // Self-loops have positive weight and never improve on the zero diagonal.
+            if (static_cast<size_t>(v) == u)
+                continue;
+            int weight = graph.getEdgeWeight(u, static_cast<size_t>(v));
+            if (weight >= TOO_FAR)
+                throw std::overflow_error("Path length overflows the distance type.");
+            dist.set(u, static_cast<size_t>(v), weight);
+            if (predecessors)
+                predAt(u, static_cast<size_t>(v)) = static_cast<std::int32_t>(u);
+        }
+    }
+
+    Kernel kernel = selectKernel();
+    auto update = [&](size_t row, size_t column, size_t pivot) {
+        kernel(dist.getTile(row, column).data(), dist.getTile(row, pivot).data(),
+            dist.getTile(pivot, column).data(), predTile(row, column), predTile(pivot, column));
+    };
+
+    for (size_t pivot = 0; pivot < blocks; ++pivot) {
+        update(pivot, pivot, pivot);
+
+        // Tiles in the pivot row or column depend only on themselves and the pivot tile.
+        parallelFor(2 * (blocks - 1), numThreads, [&](size_t, size_t item) {
+            size_t other = item / 2 < pivot ? item / 2 : item / 2 + 1;
+            if (item % 2 == 0)
+                update(pivot, other, pivot);
+            else
+                update(other, pivot, pivot);
+        });
+
+        // Every other tile depends only on its pivot-row and pivot-column tiles.
+        parallelFor((blocks - 1) * (blocks - 1), numThreads, [&](size_t, size_t item) {
+            size_t row = item / (blocks - 1);
+            size_t column = item % (blocks - 1);
+            update(row < pivot ? row : row + 1, column < pivot ? column : column + 1, pivot);
+        });
+    }
+
+    for (size_t row = 0; row < blocks; ++row)
+        for (size_t column = 0; column < blocks; ++column)
+            for (std::int32_t& entry : dist.getTile(row, column)) {
+                if (entry == TOO_FAR)
+                    throw std::overflow_error("Path length overflows the distance type.");
+                if (entry == UNREACHED)
+                    entry = INF;
+            }
+
+    if (predecessors) {
+        predecessors->assign(n * n, -1);
+        for (size_t u = 0; u < n; ++u)
+            for (size_t v = 0; v < n; ++v)
+                (*predecessors)[u * n + v] = predAt(u, v);
+    }
+
+    return dist;
+}
@@ -2,37 +2,226 @@
 #include <algorithm>
 #include <limits>
 
-bool Graph::validVertex(size_t vertex) const noexcept
+namespace {
+
+/**
+ * Records vertices in the order they are discovered.
+ */
+class OrderVisitor : public TraversalVisitor {
+public:
+    std::vector<int>& order;
+
+    explicit OrderVisitor(std::vector<int>& order)
+        : order(order)
+    {
+    }
+
+    TraversalControl discoverVertex(size_t vertex) override
+    {
+        order.push_back(static_cast<int>(vertex));
+        return TraversalControl::Continue;
+    }
+};
+
+/**
+ * Records discovered vertices up to a depth limit. Vertices at the limit are recorded but pruned,
+ * so their out-edges are never examined.
+ *
+ * BFS expands vertices level by level in queue order, so counting finished expansions is enough
+ * to know the current depth; a pruned vertex finishes right after its discovery and is skipped.
+ */
+class DepthLimitedVisitor : public OrderVisitor {
+public:
+    size_t maxDepth;
+    size_t depth = 0;
+    size_t remainingInLevel;
+    size_t nextLevel = 0;
+    bool prunedPending = false;
+
+    DepthLimitedVisitor(std::vector<int>& order, size_t maxDepth, size_t startVertices)
+        : OrderVisitor(order)
+        , maxDepth(maxDepth)
+        , remainingInLevel(startVertices)
+    {
+    }
+
+    TraversalControl discoverVertex(size_t vertex) override
+    {
+        OrderVisitor::discoverVertex(vertex);
+        if (depth + 1 >= maxDepth) {
+            prunedPending = true;
+            return TraversalControl::Prune;
+        }
+        ++nextLevel;
+        return TraversalControl::Continue;
+    }
+
+    TraversalControl finishVertex(size_t) override
+    {
+        if (prunedPending) {
+            prunedPending = false;
+            return TraversalControl::Continue;
+        }
+        if (--remainingInLevel == 0) {
+            ++depth;
+            remainingInLevel = nextLevel;
+            nextLevel = 0;
+        }
+        return TraversalControl::Continue;
+    }
+};
+
+/**
+ * Counts discovered vertices.
+ */
+class CountVisitor : public TraversalVisitor {
+public:
+    size_t count = 0;
+
+    TraversalControl discoverVertex(size_t) override
+    {
+        ++count;
+        return TraversalControl::Continue;
+    }
+};
+
+/**
+ * Marks discovered vertices in a set shared by several searches and prunes edges into vertices
+ * an earlier search already reached, so a sequence of searches forms a depth-first forest.
+ */
+class ForestVisitor : public TraversalVisitor {
+public:
+    std::vector<bool>& seen;
+
+    explicit ForestVisitor(std::vector<bool>& seen)
+        : seen(seen)
+    {
+    }
+
+    TraversalControl discoverVertex(size_t vertex) override
+    {
+        seen[vertex] = true;
+        return TraversalControl::Continue;
+    }
+
+    TraversalControl examineEdge(size_t, size_t to) override
+    {
+        return seen[to] ? TraversalControl::Prune : TraversalControl::Continue;
+    }
+};
+
+/**
+ * Stops the traversal as soon as a target vertex is discovered.
+ */
+class TargetVisitor : public TraversalVisitor {
+public:
+    size_t target;
+    bool found = false;
+
+    explicit TargetVisitor(size_t target)
+        : target(target)
+    {
+    }
+
+    TraversalControl discoverVertex(size_t vertex) override
+    {
+        found = vertex == target;
+        return found ? TraversalControl::Stop : TraversalControl::Continue;
+    }
+};
+
+} // namespace
+
+TraversalControl TraversalVisitor::discoverVertex(size_t)
 {
-    return vertex < numVertices;
+    return TraversalControl::Continue;
 }
 
-std::vector<int> Graph::depthFirstTraversalHelper(
-    size_t startVertex, std::vector<bool>& visited) const
+TraversalControl TraversalVisitor::examineEdge(size_t, size_t)
 {
-    std::vector<int> result;
-    std::stack<int> toTraverse;
+    return TraversalControl::Continue;
+}
 
-    toTraverse.push(startVertex);
+TraversalControl TraversalVisitor::finishVertex(size_t)
+{
+    return TraversalControl::Continue;
+}
 
-    while (!toTraverse.empty()) {
-        size_t currentVertex = toTraverse.top();
-        toTraverse.pop();
+TraversalWorkspace::TraversalWorkspace()
+    : generation(0)
+{
+}
 
-        if (!visited[currentVertex]) {
-            visited[currentVertex] = true;
-            result.push_back(currentVertex);
-            std::vector<int> neighbors = getNeighbors(currentVertex);
+void TraversalWorkspace::reset(size_t vertices)
+{
+    if (visitedStamp.size() < vertices)
+        visitedStamp.resize(vertices, 0);
 
-            for (size_t i = neighbors.size(); i-- > 0;) {
-                int neighbor = neighbors[i];
-                if (!visited[neighbor])
-                    toTraverse.push(neighbor);
-            }
+    // Stamps from earlier generations become stale; only a wrap-around clears them.
+    if (++generation == 0) {
+        std::fill(visitedStamp.begin(), visitedStamp.end(), 0);
+        generation = 1;
+    }
+    frames.clear();
+    queue.clear();
+    order.clear();
+}
+
+const std::vector<int>& TraversalWorkspace::getOrder() const
+{
+    return order;
+}
+
+bool Graph::validVertex(size_t vertex) const noexcept
+{
+    return vertex < numVertices;
+}
+
+bool Graph::depthFirstVisitHelper(
+    size_t startVertex, TraversalWorkspace& workspace, TraversalVisitor& visitor) const
+{
+    if (workspace.isVisited(startVertex))
+        return true;
+
+    // Each frame holds a vertex and the next column of its adjacency row to examine; a pruned
+    // vertex starts past the last column so it finishes right away.
+    std::vector<std::pair<size_t, size_t>>& frames = workspace.frames;
+    auto discover = [&](size_t vertex) {
+        workspace.markVisited(vertex);
+        TraversalControl control = visitor.discoverVertex(vertex);
+        if (control != TraversalControl::Stop)
+            frames.push_back({ vertex, control == TraversalControl::Prune ? numVertices : 0 });
+        return control != TraversalControl::Stop;
+    };
+
+    if (!discover(startVertex))
+        return false;
+
+    while (!frames.empty()) {
+        auto& [vertex, column] = frames.back();
+        while (column < numVertices && adjacencyMatrix[vertex][column] == 0)
+            ++column;
+
+        if (column == numVertices) {
+            size_t finished = vertex;
+            frames.pop_back();
+            if (visitor.finishVertex(finished) == TraversalControl::Stop)
+                return false;
+            continue;
         }
+
+        size_t from = vertex;
+        size_t next = column++;
+        TraversalControl control = visitor.examineEdge(from, next);
+        if (control == TraversalControl::Stop)
+            return false;
+        if (control == TraversalControl::Prune || workspace.isVisited(next))
+            continue;
+        if (!discover(next))
+            return false;
     }
 
-    return result;
+    return true;
 }
 
 void Graph::findHamiltonianCyclesHelper(size_t startVertex, size_t currentVertex,
@@ -62,27 +251,110 @@ void Graph::findHamiltonianCyclesHelper(size_t startVertex, size_t currentVertex
     }
 }
 
-std::vector<int> Graph::breadthFirstTraversalHelper(
-    std::vector<bool>& visited, std::queue<int>& toTraverse) const
+bool Graph::breadthFirstVisitHelper(TraversalWorkspace& workspace, TraversalVisitor& visitor) const
+{
+    // Every vertex enters the queue at most once, so it is a vector read through a head index.
+    std::vector<int>& toTraverse = workspace.queue;
+    for (size_t head = 0; head < toTraverse.size(); ++head) {
+        size_t currentVertex = static_cast<size_t>(toTraverse[head]);
+
+        for (size_t next = 0; next < numVertices; ++next) {
+            if (adjacencyMatrix[currentVertex][next] == 0)
+                continue;
+
+            TraversalControl control = visitor.examineEdge(currentVertex, next);
+            if (control == TraversalControl::Stop)
+                return false;
+            if (control == TraversalControl::Prune || workspace.isVisited(next))
+                continue;
+
+            workspace.markVisited(next);
+            control = visitor.discoverVertex(next);
+            if (control == TraversalControl::Stop)
+                return false;
+            if (control == TraversalControl::Continue)
+                toTraverse.push_back(static_cast<int>(next));
+            else if (visitor.finishVertex(next) == TraversalControl::Stop)
+                return false;
+        }
+
+        if (visitor.finishVertex(currentVertex) == TraversalControl::Stop)
+            return false;
+    }
+
+    return true;
+}
+
+Generator<int> Graph::depthFirstGenerator(size_t startVertex) const
 {
-    std::vector<int> traversal;
+    std::vector<bool> visited(numVertices, false);
+    std::stack<std::pair<size_t, size_t>> frames;
+
+    visited[startVertex] = true;
+    frames.push({ startVertex, 0 });
+    co_yield static_cast<int>(startVertex);
+
+    while (!frames.empty()) {
+        auto& [vertex, column] = frames.top();
+        while (column < numVertices && (adjacencyMatrix[vertex][column] == 0 || visited[column]))
+            ++column;
+
+        if (column == numVertices) {
+            frames.pop();
+            continue;
+        }
+
+        size_t next = column++;
+        visited[next] = true;
+        frames.push({ next, 0 });
+        co_yield static_cast<int>(next);
+    }
+}
+
+Generator<int> Graph::breadthFirstGenerator(size_t startVertex) const
+{
+    std::vector<bool> visited(numVertices, false);
+    std::queue<int> toTraverse;
+
+    visited[startVertex] = true;
+    toTraverse.push(static_cast<int>(startVertex));
+    co_yield static_cast<int>(startVertex);
 
     while (!toTraverse.empty()) {
-        int currentVertex = toTraverse.front();
+        size_t currentVertex = static_cast<size_t>(toTraverse.front());
         toTraverse.pop();
 
-        traversal.push_back(currentVertex);
-
-        std::vector<int> neighbors = getNeighbors(currentVertex);
+        for (size_t next = 0; next < numVertices; ++next) {
+            if (adjacencyMatrix[currentVertex][next] == 0 || visited[next])
+                continue;
 
-        for (int neighbor : neighbors) {
-            if (!visited[neighbor]) {
-                visited[neighbor] = true;
-                toTraverse.push(neighbor);
-            }
+            visited[next] = true;
+            toTraverse.push(static_cast<int>(next));
+            co_yield static_cast<int>(next);
         }
     }
-    return traversal;
+}
+
+void Graph::depthFirstTraversalHelper(size_t startVertex, TraversalWorkspace& workspace) const
+{
+    OrderVisitor visitor(workspace.order);
+    depthFirstVisitHelper(startVertex, workspace, visitor);
+}
+
+void Graph::breadthFirstTraversalHelper(TraversalWorkspace& workspace, size_t maxDepth) const
+{
+    // Vertices already queued were discovered by the caller, so they lead the traversal.
+    workspace.order.assign(workspace.queue.begin(), workspace.queue.end());
+    if (maxDepth == 0)
+        return;
+
+    if (maxDepth == SIZE_MAX) {
+        OrderVisitor visitor(workspace.order);
+        breadthFirstVisitHelper(workspace, visitor);
+    } else {
+        DepthLimitedVisitor visitor(workspace.order, maxDepth, workspace.queue.size());
+        breadthFirstVisitHelper(workspace, visitor);
+    }
 }
 
 Graph::Graph()
@@ -93,6 +365,9 @@ Graph::Graph()
 Graph::Graph(size_t vertices)
     : numVertices(vertices)
     , isWeighted(false)
+    , weakComponents(vertices)
+    , asymmetricEdges(0)
+    , connectivityStale(false)
 {
     adjacencyMatrix.resize(vertices, std::vector<int>(vertices, 0));
 }
@@ -100,6 +375,9 @@ Graph::Graph(size_t vertices)
 Graph::Graph(size_t vertices, bool weighted)
     : numVertices(vertices)
     , isWeighted(weighted)
+    , weakComponents(vertices)
+    , asymmetricEdges(0)
+    , connectivityStale(false)
 {
     adjacencyMatrix.resize(vertices, std::vector<int>(vertices, 0));
 }
@@ -109,6 +387,11 @@ Graph::Graph(const Graph& other)
     numVertices = other.numVertices;
     isWeighted = other.isWeighted;
     adjacencyMatrix = other.adjacencyMatrix;
+
+    std::lock_guard<std::mutex> lock(other.connectivityMutex);
+    weakComponents = other.weakComponents;
+    asymmetricEdges = other.asymmetricEdges;
+    connectivityStale = other.connectivityStale.load();
 }
 
 Graph& Graph::operator=(const Graph& other)
@@ -117,6 +400,11 @@ Graph& Graph::operator=(const Graph& other)
         numVertices = other.numVertices;
         isWeighted = other.isWeighted;
         adjacencyMatrix = other.adjacencyMatrix;
+
+        std::lock_guard<std::mutex> lock(other.connectivityMutex);
+        weakComponents = other.weakComponents;
+        asymmetricEdges = other.asymmetricEdges;
+        connectivityStale = other.connectivityStale.load();
     }
     return *this;
 }
@@ -126,6 +414,9 @@ Graph::Graph(Graph&& other) noexcept
     numVertices = other.numVertices;
     isWeighted = other.isWeighted;
     adjacencyMatrix = std::move(other.adjacencyMatrix);
+    weakComponents = std::move(other.weakComponents);
+    asymmetricEdges = other.asymmetricEdges;
+    connectivityStale = other.connectivityStale.load();
 
     other.numVertices = 0;
     other.clear();
@@ -137,6 +428,9 @@ Graph& Graph::operator=(Graph&& other) noexcept
         numVertices = other.numVertices;
         isWeighted = other.isWeighted;
         adjacencyMatrix = std::move(other.adjacencyMatrix);
+        weakComponents = std::move(other.weakComponents);
+        asymmetricEdges = other.asymmetricEdges;
+        connectivityStale = other.connectivityStale.load();
 
         other.numVertices = 0;
         other.clear();
@@ -157,6 +451,9 @@ void Graph::addVertex()
 
     for (size_t i = 0; i < numVertices - 1; ++i)
         adjacencyMatrix[i].push_back(0);
+
+    if (!connectivityStale)
+        weakComponents.addElement();
 }
 
 void Graph::removeVertex(size_t vertex)
@@ -170,6 +467,7 @@ void Graph::removeVertex(size_t vertex)
         row.erase(row.begin() + vertex);
 
     numVertices--;
+    connectivityStale = true;
 }
 
 void Graph::addEdge(size_t from, size_t to)
@@ -177,6 +475,7 @@ void Graph::addEdge(size_t from, size_t to)
     if (!validVertex(from) || !validVertex(to))
         throw std::out_of_range("One of these indices is out of range.");
 
+    trackEdgeInsertion(from, to);
     adjacencyMatrix[from][to] = 1;
 }
 
@@ -188,6 +487,7 @@ void Graph::addEdge(size_t from, size_t to, int weight)
     if (weight <= 0)
         throw std::invalid_argument("Weight cannot be less than or equal zero.");
 
+    trackEdgeInsertion(from, to);
     adjacencyMatrix[from][to] = weight;
 }
 
@@ -202,9 +502,53 @@ void Graph::removeEdge(size_t from, size_t to)
     if (!validVertex(from) || !validVertex(to))
         throw std::out_of_range("One of these indices is out of range.");
 
+    // Removing one direction of a two-way edge leaves the weak components unchanged.
+    if (!connectivityStale && from != to && adjacencyMatrix[from][to] != 0) {
+        if (adjacencyMatrix[to][from] != 0) {
+            ++asymmetricEdges;
+        } else {
+            --asymmetricEdges;
+            connectivityStale = true;
+        }
+    }
     adjacencyMatrix[from][to] = 0;
 }
 
+void Graph::trackEdgeInsertion(size_t from, size_t to)
+{
+    if (connectivityStale || from == to || adjacencyMatrix[from][to] != 0)
+        return;
+
+    if (adjacencyMatrix[to][from] != 0)
+        --asymmetricEdges;
+    else
+        ++asymmetricEdges;
+    weakComponents.unite(from, to);
+}
+
+void Graph::refreshConnectivity() const
+{
+    if (!connectivityStale.load(std::memory_order_acquire))
+        return;
+
+    std::lock_guard<std::mutex> lock(connectivityMutex);
+    if (!connectivityStale.load(std::memory_order_relaxed))
+        return;
+
+    weakComponents.reset(numVertices);
+    asymmetricEdges = 0;
+    for (size_t row = 0; row < numVertices; ++row) {
+        for (size_t col = 0; col < numVertices; ++col) {
+            if (row == col || adjacencyMatrix[row][col] == 0)
+                continue;
+            weakComponents.unite(row, col);
+            if (adjacencyMatrix[col][row] == 0)
+                ++asymmetricEdges;
+        }
+    }
+    connectivityStale.store(false, std::memory_order_release);
+}
+
 bool Graph::isAdjacent(size_t v1, size_t v2) const
 {
     if (!validVertex(v1) || !validVertex(v2))
@@ -259,45 +603,134 @@ size_t Graph::getDegree(size_t vertex) const
     return count;
 }
 
+Graph Graph::transpose() const
+{
+    Graph transposed(numVertices, isWeighted);
+    for (size_t row = 0; row < numVertices; ++row)
+        for (size_t col = 0; col < numVertices; ++col)
+            transposed.adjacencyMatrix[col][row] = adjacencyMatrix[row][col];
+
+    transposed.connectivityStale = true;
+    return transposed;
+}
+
+std::vector<int> Graph::kHopNeighborhood(size_t vertex, size_t k) const
+{
+    TraversalWorkspace workspace;
+    kHopNeighborhood(vertex, k, workspace);
+    return std::move(workspace.order);
+}
+
+const std::vector<int>& Graph::kHopNeighborhood(
+    size_t vertex, size_t k, TraversalWorkspace& workspace) const
+{
+    if (!validVertex(vertex))
+        throw std::out_of_range("This index is out of range.");
+
+    workspace.reset(numVertices);
+    workspace.queue.push_back(static_cast<int>(vertex));
+    workspace.markVisited(vertex);
+    breadthFirstTraversalHelper(workspace, k);
+    return workspace.order;
+}
+
+Graph Graph::egoNetwork(size_t vertex, size_t k, std::vector<int>* vertices) const
+{
+    std::vector<int> members = kHopNeighborhood(vertex, k);
+
+    Graph ego(members.size(), isWeighted);
+    for (size_t i = 0; i < members.size(); ++i) {
+        const std::vector<int>& row = adjacencyMatrix[static_cast<size_t>(members[i])];
+        for (size_t j = 0; j < members.size(); ++j)
+            ego.adjacencyMatrix[i][j] = row[static_cast<size_t>(members[j])];
+    }
+    ego.connectivityStale = true;
+
+    if (vertices)
+        *vertices = std::move(members);
+    return ego;
+}
+
 bool Graph::isConnected() const
 {
-    for (size_t i = 0; i < numVertices; i++) {
-        std::vector<int> traversal = depthFirstTraversal(i);
+    if (numVertices == 0)
+        return false;
 
-        if (traversal.size() == numVertices)
-            return true;
+    refreshConnectivity();
+    if (weakComponents.getNumSets() > 1)
+        return false;
+    if (asymmetricEdges == 0)
+        return true;
+
+    // The root of the last tree in a depth-first forest reaches every vertex if any vertex does:
+    // such a vertex lies in the last tree, or its search would have reached the last root first.
+    std::vector<bool> seen(numVertices, false);
+    TraversalWorkspace workspace;
+    ForestVisitor forest(seen);
+    size_t candidate = 0;
+    for (size_t i = 0; i < numVertices; i++) {
+        if (!seen[i]) {
+            candidate = i;
+            depthFirstVisit(i, forest, workspace);
+        }
     }
-    return false;
+
+    CountVisitor visitor;
+    depthFirstVisit(candidate, visitor, workspace);
+    return visitor.count == numVertices;
+}
+
+bool Graph::areVerticesConnected(size_t u, size_t v) const
+{
+    if (!validVertex(u) || !validVertex(v))
+        throw std::out_of_range("One of these indices is out of range.");
+
+    refreshConnectivity();
+    return weakComponents.connected(u, v);
+}
+
+size_t Graph::getNumConnectedComponents() const
+{
+    refreshConnectivity();
+    return weakComponents.getNumSets();
 }
 
 bool Graph::isStronglyConnected() const
 {
+    TraversalWorkspace workspace;
     for (size_t i = 0; i < numVertices; i++) {
-        std::vector<int> traversal = depthFirstTraversal(i);
+        CountVisitor visitor;
+        depthFirstVisit(i, visitor, workspace);
 
-        if (traversal.size() < numVertices)
+        if (visitor.count < numVertices)
             return false;
     }
     return true;
 }
 
 bool Graph::areVerticesStronglyConnected(size_t u, size_t v) const
+{
+    TraversalWorkspace workspace;
+    return areVerticesStronglyConnected(u, v, workspace);
+}
+
+bool Graph::areVerticesStronglyConnected(size_t u, size_t v, TraversalWorkspace& workspace) const
 {
     if (!validVertex(u) || !validVertex(v))
         throw std::out_of_range("One of these indices is out of range.");
 
-    // Check if there's a path from u to v
-    std::vector<int> fromU = depthFirstTraversal(u);
-    bool uToV = std::find(fromU.begin(), fromU.end(), v) != fromU.end();
+    // Check if there's a path from u to v; the search stops once v is discovered
+    TargetVisitor toV(v);
+    depthFirstVisit(u, toV, workspace);
 
-    if (!uToV)
+    if (!toV.found)
         return false;
 
     // Check if there's a path from v to u
-    std::vector<int> fromV = depthFirstTraversal(v);
-    bool vToU = std::find(fromV.begin(), fromV.end(), u) != fromV.end();
+    TargetVisitor toU(u);
+    depthFirstVisit(v, toU, workspace);
 
-    return vToU;
+    return toU.found;
 }
 
 bool Graph::hasCycle() const
@@ -482,32 +915,108 @@ std::pair<std::vector<int>, int> Graph::travelingSalesman() const
 }
 
 std::vector<int> Graph::depthFirstTraversal(size_t startVertex) const
+{
+    TraversalWorkspace workspace;
+    depthFirstTraversal(startVertex, workspace);
+    return std::move(workspace.order);
+}
+
+std::vector<int> Graph::breadthFirstTraversal(size_t startVertex) const
+{
+    TraversalWorkspace workspace;
+    breadthFirstTraversal(startVertex, workspace);
+    return std::move(workspace.order);
+}
+
+const std::vector<int>& Graph::depthFirstTraversal(
+    size_t startVertex, TraversalWorkspace& workspace) const
 {
     if (!validVertex(startVertex))
         throw std::out_of_range("This index is out of range.");
 
-    std::vector<bool> visited(numVertices, false);
-    return depthFirstTraversalHelper(startVertex, visited);
+    workspace.reset(numVertices);
+    depthFirstTraversalHelper(startVertex, workspace);
+    return workspace.order;
 }
 
-std::vector<int> Graph::breadthFirstTraversal(size_t startVertex) const
+const std::vector<int>& Graph::breadthFirstTraversal(
+    size_t startVertex, TraversalWorkspace& workspace) const
 {
     if (!validVertex(startVertex))
         throw std::out_of_range("This index is out of range.");
 
-    std::vector<bool> visited(numVertices, false);
-    std::queue<int> toTraverse;
-    toTraverse.push(startVertex);
-    visited[startVertex] = true;
+    workspace.reset(numVertices);
+    workspace.queue.push_back(static_cast<int>(startVertex));
+    workspace.markVisited(startVertex);
+    breadthFirstTraversalHelper(workspace);
+    return workspace.order;
+}
+
+bool Graph::depthFirstVisit(size_t startVertex, TraversalVisitor& visitor) const
+{
+    TraversalWorkspace workspace;
+    return depthFirstVisit(startVertex, visitor, workspace);
+}
+
+bool Graph::depthFirstVisit(
+    size_t startVertex, TraversalVisitor& visitor, TraversalWorkspace& workspace) const
+{
+    if (!validVertex(startVertex))
+        throw std::out_of_range("This index is out of range.");
+
+    workspace.reset(numVertices);
+    return depthFirstVisitHelper(startVertex, workspace, visitor);
+}
+
+bool Graph::breadthFirstVisit(size_t startVertex, TraversalVisitor& visitor) const
+{
+    TraversalWorkspace workspace;
+    return breadthFirstVisit(startVertex, visitor, workspace);
+}
+
+bool Graph::breadthFirstVisit(
+    size_t startVertex, TraversalVisitor& visitor, TraversalWorkspace& workspace) const
+{
+    if (!validVertex(startVertex))
+        throw std::out_of_range("This index is out of range.");
+
+    workspace.reset(numVertices);
+    workspace.markVisited(startVertex);
+
+    TraversalControl control = visitor.discoverVertex(startVertex);
+    if (control == TraversalControl::Stop)
+        return false;
+    if (control == TraversalControl::Prune)
+        return visitor.finishVertex(startVertex) != TraversalControl::Stop;
+
+    workspace.queue.push_back(static_cast<int>(startVertex));
+    return breadthFirstVisitHelper(workspace, visitor);
+}
+
+Generator<int> Graph::depthFirstRange(size_t startVertex) const
+{
+    // Validated here because the coroutine body only runs once the range is iterated.
+    if (!validVertex(startVertex))
+        throw std::out_of_range("This index is out of range.");
+
+    return depthFirstGenerator(startVertex);
+}
+
+Generator<int> Graph::breadthFirstRange(size_t startVertex) const
+{
+    if (!validVertex(startVertex))
+        throw std::out_of_range("This index is out of range.");
 
-    std::vector<int> traversal = breadthFirstTraversalHelper(visited, toTraverse);
-    return traversal;
+    return breadthFirstGenerator(startVertex);
 }
 
 void Graph::clear()
 {
     numVertices = 0;
     adjacencyMatrix.clear();
+    weakComponents.reset(0);
+    asymmetricEdges = 0;
+    connectivityStale = false;
 }
 
 std::string Graph::toString() const
@@ -0,0 +1,224 @@
+#include "IncrementalTopologicalOrder.h"
+#include <algorithm>
+#include <stdexcept>
+#include <tuple>
+
+IncrementalTopologicalOrder::IncrementalTopologicalOrder(size_t vertices)
+    : generation(0)
+    , lastReorderSize(0)
+{
+    initialize(vertices, {});
+}
+
+IncrementalTopologicalOrder::IncrementalTopologicalOrder(const Graph& graph)
+    : IncrementalTopologicalOrder(CsrGraph(graph))
+{
+}
+
+IncrementalTopologicalOrder::IncrementalTopologicalOrder(const CsrGraph& graph)
+    : generation(0)
+    , lastReorderSize(0)
+{
+    initialize(graph.getNumVertices(), graph.getEdges());
+}
+
+bool IncrementalTopologicalOrder::validVertex(size_t vertex) const noexcept
+{
+    return vertex < position.size();
+}
+
+void IncrementalTopologicalOrder::initialize(
+    size_t vertices, const std::vector<CsrGraph::Edge>& edges)
+{
+    out.assign(vertices, {});
+    in.assign(vertices, {});
+    visitedStamp.assign(vertices, 0);
+    generation = 0;
+
+    std::vector<CsrGraph::Edge> sorted = edges;
+    std::sort(sorted.begin(), sorted.end(), [](const CsrGraph::Edge& a, const CsrGraph::Edge& b) {
+        return std::tie(a.from, a.to) < std::tie(b.from, b.to);
+    });
+    for (size_t i = 0; i < sorted.size(); ++i) {
+        const CsrGraph::Edge& edge = sorted[i];
+        if (i > 0 && sorted[i - 1].from == edge.from && sorted[i - 1].to == edge.to)
+            continue;
+        out[static_cast<size_t>(edge.from)].push_back(edge.to);
+        in[static_cast<size_t>(edge.to)].push_back(edge.from);
+    }
+
+    // Kahn's algorithm, once; later insertions only touch the affected region.
+    std::vector<size_t> inDegree(vertices);
+    for (size_t v = 0; v < vertices; ++v)
+        inDegree[v] = in[v].size();
+    vertexAt.clear();
+    vertexAt.reserve(vertices);
+    for (size_t v = 0; v < vertices; ++v)
+        if (inDegree[v] == 0)
+            vertexAt.push_back(static_cast<int>(v));
+    for (size_t head = 0; head < vertexAt.size(); ++head)
+        for (int next : out[static_cast<size_t>(vertexAt[head])])
+            if (--inDegree[static_cast<size_t>(next)] == 0)
+                vertexAt.push_back(next);
+
+    if (vertexAt.size() != vertices)
+        throw std::runtime_error("Graph contains a cycle; topological sort is not possible.");
+
+    position.assign(vertices, 0);
+    for (size_t i = 0; i < vertices; ++i)
+        position[static_cast<size_t>(vertexAt[i])] = static_cast<int>(i);
+}
+
+bool IncrementalTopologicalOrder::searchForward(int start, int bound)
+{
+    stack.assign(1, start);
+    visitedStamp[static_cast<size_t>(start)] = generation;
+    while (!stack.empty()) {
+        int vertex = stack.back();
+        stack.pop_back();
+        forward.push_back(vertex);
+        for (int next : out[static_cast<size_t>(vertex)]) {
+            size_t w = static_cast<size_t>(next);
+            if (position[w] == bound)
+                return false;
+            if (visitedStamp[w] != generation && position[w] < bound) {
+                visitedStamp[w] = generation;
+                stack.push_back(next);
+            }
+        }
+    }
+    return true;
+}
+
+void IncrementalTopologicalOrder::searchBackward(int start, int bound)
+{
+    stack.assign(1, start);
+    visitedStamp[static_cast<size_t>(start)] = generation;
+    while (!stack.empty()) {
+        int vertex = stack.back();
+        stack.pop_back();
+        backward.push_back(vertex);
+        for (int previous : in[static_cast<size_t>(vertex)]) {
+            size_t w = static_cast<size_t>(previous);
+            if (visitedStamp[w] != generation && position[w] > bound) {
+                visitedStamp[w] = generation;
+                stack.push_back(previous);
+            }
+        }
+    }
+}
+
+void IncrementalTopologicalOrder::reorder()
+{
+    auto byPosition = [this](int a, int b) {
+        return position[static_cast<size_t>(a)] < position[static_cast<size_t>(b)];
+    };
+    std::sort(backward.begin(), backward.end(), byPosition);
+    std::sort(forward.begin(), forward.end(), byPosition);
+
+    // The two sets keep their internal orders and swap places within the positions they occupy.
+    slots.clear();
+    for (int vertex : backward)
+        slots.push_back(position[static_cast<size_t>(vertex)]);
+    for (int vertex : forward)
+        slots.push_back(position[static_cast<size_t>(vertex)]);
+    std::sort(slots.begin(), slots.end());
+
+    size_t next = 0;
+    for (const std::vector<int>* group : { &backward, &forward }) {
+        for (int vertex : *group) {
+            int slot = slots[next++];
+            position[static_cast<size_t>(vertex)] = slot;
+            vertexAt[static_cast<size_t>(slot)] = vertex;
+        }
+    }
+    lastReorderSize = slots.size();
+}
+
+size_t IncrementalTopologicalOrder::getNumVertices() const
+{
+    return position.size();
+}
+
+const std::vector<int>& IncrementalTopologicalOrder::order() const
+{
+    return vertexAt;
+}
+
+size_t IncrementalTopologicalOrder::getPosition(size_t vertex) const
+{
+    if (!validVertex(vertex))
+        throw std::out_of_range("This index is out of range.");
+
+    return static_cast<size_t>(position[vertex]);
+}
+
+bool IncrementalTopologicalOrder::hasEdge(size_t from, size_t to) const
+{
+    if (!validVertex(from) || !validVertex(to))
+        throw std::out_of_range("One of these indices is out of range.");
+
+    const std::vector<int>& arcs = out[from];
+    return std::find(arcs.begin(), arcs.end(), static_cast<int>(to)) != arcs.end();
+}
+
+size_t IncrementalTopologicalOrder::getLastReorderSize() const
+{
+    return lastReorderSize;
+}
+
+void IncrementalTopologicalOrder::addVertex()
+{
+    int vertex = static_cast<int>(position.size());
+    out.emplace_back();
+    in.emplace_back();
+    visitedStamp.push_back(0);
+    position.push_back(vertex);
+    vertexAt.push_back(vertex);
+}
+
+bool IncrementalTopologicalOrder::addEdge(size_t from, size_t to)
+{
+    if (hasEdge(from, to))
+        return true;
+    if (from == to)
+        return false;
+
+    int lower = position[to];
+    int upper = position[from];
+    if (lower < upper) {
+        // Stamps from earlier searches become stale; only a wrap-around clears them.
+        if (++generation == 0) {
+            std::fill(visitedStamp.begin(), visitedStamp.end(), 0);
+            generation = 1;
+        }
+        forward.clear();
+        backward.clear();
+        if (!searchForward(static_cast<int>(to), upper))
+            return false;
+        searchBackward(static_cast<int>(from), lower);
+        reorder();
+    } else {
+        lastReorderSize = 0;
+    }
+
+    out[from].push_back(static_cast<int>(to));
+    in[to].push_back(static_cast<int>(from));
+    return true;
+}
+
+void IncrementalTopologicalOrder::removeEdge(size_t from, size_t to)
+{
+    if (!validVertex(from) || !validVertex(to))
+        throw std::out_of_range("One of these indices is out of range.");
+
+    auto erase = [](std::vector<int>& arcs, int vertex) {
+        auto it = std::find(arcs.begin(), arcs.end(), vertex);
+        if (it != arcs.end()) {
+            *it = arcs.back();
+            arcs.pop_back();
+        }
+    };
+    erase(out[from], static_cast<int>(to));
+    erase(in[to], static_cast<int>(from));
+}
@@ -0,0 +1,240 @@
+#include "LandmarkIndex.h"
+#include "Parallel.h"
+#include "Serialization.h"
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <stdexcept>
+
+namespace {
+
+const int INF = std::numeric_limits<int>::max();
+const char MAGIC[4] = { 'G', 'T', 'L', 'M' };
+const std::uint32_t FORMAT_VERSION = 1;
+
+} // namespace
+
+LandmarkIndex::LandmarkIndex()
+    : numVertices(0)
+{
+}
+
+LandmarkIndex::LandmarkIndex(
+    const Graph& graph, const std::vector<int>& landmarks, size_t numThreads)
+    : numVertices(graph.getNumVertices())
+    , landmarks(landmarks)
+{
+    for (int landmark : landmarks)
+        if (landmark < 0 || static_cast<size_t>(landmark) >= numVertices)
+            throw std::out_of_range("Landmark vertex is out of range.");
+
+    computeTables(CsrGraph(graph), numThreads);
+}
+
+LandmarkIndex::LandmarkIndex(
+    const Graph& graph, size_t numLandmarks, LandmarkSelection selection, size_t numThreads)
+    : numVertices(graph.getNumVertices())
+{
+    numLandmarks = std::min(numLandmarks, numVertices);
+    if (numLandmarks == 0)
+        return;
+
+    CsrGraph csr(graph);
+    ShortestPathWorkspace workspace;
+
+    std::vector<bool> isLandmark(numVertices, false);
+    // Smallest distance from any chosen landmark; INF marks vertices no landmark reaches yet.
+    std::vector<int> cover(numVertices, INF);
+
+    auto addLandmark = [&](size_t vertex) {
+        landmarks.push_back(static_cast<int>(vertex));
+        isLandmark[vertex] = true;
+        dijkstra(csr, vertex, workspace);
+        fromLandmark.push_back(workspace.distances());
+        for (size_t v = 0; v < numVertices; ++v)
+            cover[v] = std::min(cover[v], fromLandmark.back()[v]);
+    };
+
+    auto farthestCandidate = [&]() {
+        size_t best = numVertices;
+        for (size_t v = 0; v < numVertices; ++v)
+            if (!isLandmark[v] && (best == numVertices || cover[v] > cover[best]))
+                best = v;
+        return best;
+    };
+
+    // Both strategies start from the vertex farthest from vertex 0.
+    dijkstra(csr, 0, workspace);
+    std::vector<int> fromZero = workspace.distances();
+    size_t first = 0;
+    for (size_t v = 0; v < numVertices; ++v)
+        if (fromZero[v] != INF && fromZero[v] > fromZero[first])
+            first = v;
+    addLandmark(first);
+
+    std::mt19937 gen(0);
+    std::uniform_int_distribution<size_t> vertexDist(0, numVertices - 1);
+
+    while (landmarks.size() < numLandmarks) {
+        if (selection == LandmarkSelection::FarthestPoint) {
+            addLandmark(farthestCandidate());
+            continue;
+        }
+
+        // Avoid: grow a shortest-path tree from a random root, weight each vertex by how badly
+        // the current landmarks bound its distance from the root, and descend into the heaviest
+        // subtree that contains no landmark. Its leaf becomes the next landmark.
+        size_t root = vertexDist(gen);
+        dijkstra(csr, root, workspace);
+        std::vector<int> dist = workspace.distances();
+        std::vector<int> pred = workspace.predecessors();
+
+        std::vector<size_t> order;
+        for (size_t v = 0; v < numVertices; ++v)
+            if (dist[v] != INF)
+                order.push_back(v);
+        std::sort(order.begin(), order.end(),
+            [&dist](size_t a, size_t b) { return dist[a] > dist[b]; });
+
+        std::vector<long long> size(numVertices, 0);
+        std::vector<bool> hasLandmark(isLandmark);
+        for (size_t v : order) {
+            size[v] += dist[v] - lowerBound(root, v);
+            if (pred[v] != -1) {
+                size[static_cast<size_t>(pred[v])] += size[v];
+                if (hasLandmark[v])
+                    hasLandmark[static_cast<size_t>(pred[v])] = true;
+            }
+        }
+
+        std::vector<std::vector<size_t>> children(numVertices);
+        for (size_t v : order)
+            if (pred[v] != -1)
+                children[static_cast<size_t>(pred[v])].push_back(v);
+
+        size_t current = root;
+        while (true) {
+            size_t next = numVertices;
+            for (size_t child : children[current])
+                if (!hasLandmark[child] && size[child] > 0
+                    && (next == numVertices || size[child] > size[next]))
+                    next = child;
+            if (next == numVertices)
+                break;
+            current = next;
+        }
+        addLandmark(isLandmark[current] ? farthestCandidate() : current);
+    }
+
+    computeTables(csr, numThreads);
+}
+
+void LandmarkIndex::computeTables(const CsrGraph& graph, size_t numThreads)
+{
+    size_t k = landmarks.size();
+    size_t computedFrom = fromLandmark.size();
+    fromLandmark.resize(k);
+    toLandmark.assign(k, {});
+
+    CsrGraph transposed = graph.transpose();
+
+    // Jobs [0, k - computedFrom) fill forward tables, the remaining k jobs fill reverse tables.
+    size_t missingFrom = k - computedFrom;
+    std::vector<ShortestPathWorkspace> workspaces(resolveThreadCount(numThreads, missingFrom + k));
+    parallelFor(missingFrom + k, numThreads, [&](size_t worker, size_t job) {
+        ShortestPathWorkspace& workspace = workspaces[worker];
+        if (job < missingFrom) {
+            size_t i = computedFrom + job;
+            dijkstra(graph, static_cast<size_t>(landmarks[i]), workspace);
+            fromLandmark[i] = workspace.distances();
+        } else {
+            size_t i = job - missingFrom;
+            dijkstra(transposed, static_cast<size_t>(landmarks[i]), workspace);
+            toLandmark[i] = workspace.distances();
+        }
+    });
+}
+
+size_t LandmarkIndex::getNumVertices() const
+{
+    return numVertices;
+}
+
+const std::vector<int>& LandmarkIndex::getLandmarks() const
+{
+    return landmarks;
+}
+
+int LandmarkIndex::lowerBound(size_t from, size_t to) const
+{
+    if (from >= numVertices || to >= numVertices)
+        throw std::out_of_range("One of these indices is out of range.");
+
+    int bound = 0;
+    for (const std::vector<int>& table : fromLandmark) {
+        // dist(L, to) <= dist(L, from) + dist(from, to)
+        if (table[to] != INF && table[from] != INF)
+            bound = std::max(bound, table[to] - table[from]);
+    }
+    for (const std::vector<int>& table : toLandmark) {
+        // dist(from, L) <= dist(from, to) + dist(to, L)
+        if (table[from] != INF && table[to] != INF)
+            bound = std::max(bound, table[from] - table[to]);
+    }
+    return bound;
+}
+
+Heuristic LandmarkIndex::heuristic(size_t target) const
+{
+    if (target >= numVertices)
+        throw std::out_of_range("Target vertex is out of range.");
+
+    return [this, target](size_t vertex) { return lowerBound(vertex, target); };
+}
+
+void LandmarkIndex::save(std::ostream& out) const
+{
+    out.write(MAGIC, sizeof(MAGIC));
+    writeValue<std::uint32_t>(out, FORMAT_VERSION);
+    writeValue<std::uint64_t>(out, numVertices);
+    writeValue<std::uint64_t>(out, landmarks.size());
+
+    for (int landmark : landmarks)
+        writeValue<std::int32_t>(out, landmark);
+    for (const std::vector<int>& table : fromLandmark)
+        writeInts(out, table);
+    for (const std::vector<int>& table : toLandmark)
+        writeInts(out, table);
+
+    if (!out)
+        throw std::runtime_error("Failed to write landmark index.");
+}
+
+LandmarkIndex LandmarkIndex::load(std::istream& in)
+{
+    char magic[sizeof(MAGIC)];
+    if (!in.read(magic, sizeof(magic)) || !std::equal(magic, magic + sizeof(magic), MAGIC))
+        throw std::runtime_error("Stream does not contain a landmark index.");
+    if (readValue<std::uint32_t>(in) != FORMAT_VERSION)
+        throw std::runtime_error("Unsupported landmark index version.");
+
+    LandmarkIndex index;
+    index.numVertices = readVertexCount(in);
+    size_t k = readValue<std::uint64_t>(in);
+    if (k > index.numVertices)
+        throw std::runtime_error("Landmark index has more landmarks than vertices.");
+
+    for (size_t i = 0; i < k; ++i) {
+        int landmark = readValue<std::int32_t>(in);
+        if (landmark < 0 || static_cast<size_t>(landmark) >= index.numVertices)
+            throw std::runtime_error("Landmark index contains an invalid landmark.");
+        index.landmarks.push_back(landmark);
+    }
+    for (size_t i = 0; i < k; ++i)
+        index.fromLandmark.push_back(readInts(in, index.numVertices));
+    for (size_t i = 0; i < k; ++i)
+        index.toLandmark.push_back(readInts(in, index.numVertices));
+
+    return index;
+}
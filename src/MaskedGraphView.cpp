@@ -0,0 +1,54 @@
+#include "MaskedGraphView.h"
+#include <algorithm>
+#include <stdexcept>
+
+MaskedGraphView::MaskedGraphView(const CsrGraph& graph)
+    : graph(&graph)
+    , hiddenEdgeStamp(graph.getNumEdges(), 0)
+    , hiddenVertexStamp(graph.getNumVertices(), 0)
+    , generation(1)
+{
+}
+
+const CsrGraph& MaskedGraphView::getGraph() const
+{
+    return *graph;
+}
+
+void MaskedGraphView::hideEdge(size_t edge)
+{
+    if (edge >= hiddenEdgeStamp.size())
+        throw std::out_of_range("This edge is out of range.");
+
+    hiddenEdgeStamp[edge] = generation;
+}
+
+void MaskedGraphView::hideEdges(size_t from, size_t to)
+{
+    if (to >= hiddenVertexStamp.size())
+        throw std::out_of_range("This index is out of range.");
+
+    std::span<const int> neighbors = graph->getNeighbors(from);
+    size_t firstEdge = graph->edgeBegin(from);
+    for (size_t i = 0; i < neighbors.size(); ++i)
+        if (static_cast<size_t>(neighbors[i]) == to)
+            hiddenEdgeStamp[firstEdge + i] = generation;
+}
+
+void MaskedGraphView::hideVertex(size_t vertex)
+{
+    if (vertex >= hiddenVertexStamp.size())
+        throw std::out_of_range("This index is out of range.");
+
+    hiddenVertexStamp[vertex] = generation;
+}
+
+void MaskedGraphView::showAll()
+{
+    // Stamps from earlier generations become stale; only a wrap-around clears them.
+    if (++generation == 0) {
+        std::fill(hiddenEdgeStamp.begin(), hiddenEdgeStamp.end(), 0);
+        std::fill(hiddenVertexStamp.begin(), hiddenVertexStamp.end(), 0);
+        generation = 1;
+    }
+}
@@ -0,0 +1,94 @@
+#ifndef GRAPH_TOOLKIT_PARALLEL_H
+#define GRAPH_TOOLKIT_PARALLEL_H
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Resolves a requested thread count against the available hardware and work.
+ * @param requested Requested number of threads, 0 for one per hardware thread.
+ * @param workItems Number of independent work items; no more threads than this are used.
+ * @return Number of threads to launch (at least 1).
+ */
+inline size_t resolveThreadCount(size_t requested, size_t workItems)
+{
+    size_t threads = requested;
+    if (threads == 0)
+        threads = std::max<size_t>(1, std::thread::hardware_concurrency());
+    return std::max<size_t>(1, std::min(threads, workItems));
+}
+
+/**
+ * @brief Runs body(worker, item) for every item in [0, count) on a pool of threads.
+ * @param count Number of work items.
+ * @param numThreads Requested number of threads, 0 for one per hardware thread.
+ * @param body Callable taking the worker index in [0, threads) and the item index.
+ *
+ * @note Items are handed out dynamically through an atomic counter. The worker index lets callers
+ * keep per-thread scratch state. The first exception thrown by any worker is rethrown after all
+ * workers have joined.
+ */
+template <typename Body> void parallelFor(size_t count, size_t numThreads, Body&& body)
+{
+    size_t threads = resolveThreadCount(numThreads, count);
+
+    if (threads == 1) {
+        for (size_t item = 0; item < count; ++item)
+            body(0, item);
+        return;
+    }
+
+    std::atomic<size_t> next { 0 };
+    std::exception_ptr failure;
+    std::mutex failureMutex;
+
+    auto worker = [&](size_t workerIndex) {
+        try {
+            for (size_t item = next++; item < count; item = next++)
+                body(workerIndex, item);
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(failureMutex);
+            if (!failure)
+                failure = std::current_exception();
+            next = count;
+        }
+    };
+
+    std::vector<std::thread> pool;
+    pool.reserve(threads - 1);
+    for (size_t t = 1; t < threads; ++t)
+        pool.emplace_back(worker, t);
+    worker(0);
+
+    for (std::thread& thread : pool)
+        thread.join();
+
+    if (failure)
+        std::rethrow_exception(failure);
+}
+
+/**
+ * @brief Runs body(worker) once on each of a fixed number of threads and waits for all of them.
+ * @param threads Number of workers; the calling thread runs worker 0.
+ * @param body Callable taking the worker index in [0, threads). Must not throw.
+ *
+ * @note Intended for long-lived workers that synchronize among themselves, e.g. with a
+ * std::barrier between rounds, where parallelFor would relaunch threads every round.
+ */
+template <typename Body> void runWorkers(size_t threads, Body&& body)
+{
+    std::vector<std::thread> pool;
+    pool.reserve(threads > 0 ? threads - 1 : 0);
+    for (size_t t = 1; t < threads; ++t)
+        pool.emplace_back(body, t);
+    body(0);
+
+    for (std::thread& thread : pool)
+        thread.join();
+}
+
+#endif // GRAPH_TOOLKIT_PARALLEL_H
@@ -0,0 +1,31 @@
+#ifndef GRAPH_TOOLKIT_PATH_LENGTH_H
+#define GRAPH_TOOLKIT_PATH_LENGTH_H
+
+#include "Algorithms.h"
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+
+/**
+ * @brief Adds an edge weight to a path length, the one overflow rule of every search.
+ *
+ * int sums are checked so they throw instead of wrapping, and must stay below INT_MAX, which
+ * marks unreachable vertices. int64_t cannot overflow with fewer than 2^32 int edges on a path,
+ * and floating point saturates to infinity, so those need no check.
+ *
+ * @param length A finite path length.
+ * @param weight Weight of the edge appended to the path.
+ * @return The extended length.
+ * @throws std::overflow_error if an int sum reaches INT_MAX or falls below INT_MIN.
+ */
+template <DistanceType Distance> Distance extend(Distance length, int weight)
+{
+    if constexpr (std::is_same_v<Distance, int>) {
+        if (weight >= 0 ? length >= std::numeric_limits<int>::max() - weight
+                        : length < std::numeric_limits<int>::min() - weight)
+            throw std::overflow_error("Path length overflows the distance type.");
+    }
+    return length + static_cast<Distance>(weight);
+}
+
+#endif // GRAPH_TOOLKIT_PATH_LENGTH_H
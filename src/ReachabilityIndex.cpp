@@ -0,0 +1,241 @@
+#include "ReachabilityIndex.h"
+#include "Serialization.h"
+#include <algorithm>
+#include <bit>
+#include <stdexcept>
+#include <utility>
+
+namespace {
+
+const char MAGIC[4] = { 'G', 'T', 'R', 'I' };
+const std::uint32_t FORMAT_VERSION = 1;
+
+} // namespace
+
+ReachabilityIndex::ReachabilityIndex()
+    : numVertices(0)
+    , numComponents(0)
+    , rowWords(0)
+{
+}
+
+ReachabilityIndex::ReachabilityIndex(const CsrGraph& graph)
+    : numVertices(graph.getNumVertices())
+    , numComponents(0)
+    , rowWords(0)
+{
+    condense(graph);
+    computeClosure(graph);
+}
+
+ReachabilityIndex::ReachabilityIndex(const Graph& graph)
+    : ReachabilityIndex(CsrGraph(graph))
+{
+}
+
+void ReachabilityIndex::condense(const CsrGraph& graph)
+{
+    std::vector<int> order(numVertices, -1); // discovery order, -1 until visited
+    std::vector<int> low(numVertices, 0);
+    std::vector<bool> onStack(numVertices, false);
+    std::vector<int> stack;
+    std::vector<std::pair<int, size_t>> frames; // vertex and index of its next neighbor
+    component.assign(numVertices, -1);
+    int discovered = 0;
+
+    for (size_t root = 0; root < numVertices; ++root) {
+        if (order[root] >= 0)
+            continue;
+
+        frames.emplace_back(static_cast<int>(root), 0);
+        order[root] = low[root] = discovered++;
+        stack.push_back(static_cast<int>(root));
+        onStack[root] = true;
+
+        while (!frames.empty()) {
+            auto& [vertex, next] = frames.back();
+            size_t u = static_cast<size_t>(vertex);
+            std::span<const int> neighbors = graph.getNeighbors(u);
+
+            if (next < neighbors.size()) {
+                size_t w = static_cast<size_t>(neighbors[next++]);
+                if (order[w] < 0) {
+                    order[w] = low[w] = discovered++;
+                    stack.push_back(static_cast<int>(w));
+                    onStack[w] = true;
+                    frames.emplace_back(static_cast<int>(w), 0);
+                } else if (onStack[w]) {
+                    low[u] = std::min(low[u], order[w]);
+                }
+                continue;
+            }
+
+            // Tarjan completes components sinks first, i.e. in reverse topological order.
+            if (low[u] == order[u]) {
+                int id = static_cast<int>(numComponents++);
+                int member;
+                do {
+                    member = stack.back();
+                    stack.pop_back();
+                    onStack[static_cast<size_t>(member)] = false;
+                    component[static_cast<size_t>(member)] = id;
+                } while (member != vertex);
+            }
+
+            frames.pop_back();
+            if (!frames.empty()) {
+                size_t parent = static_cast<size_t>(frames.back().first);
+                low[parent] = std::min(low[parent], low[u]);
+            }
+        }
+    }
+
+    componentSize.assign(numComponents, 0);
+    for (int& c : component) {
+        c = static_cast<int>(numComponents) - 1 - c;
+        ++componentSize[static_cast<size_t>(c)];
+    }
+}
+
+void ReachabilityIndex::computeClosure(const CsrGraph& graph)
+{
+    rowWords = (numComponents + 63) / 64;
+    closure.assign(numComponents * rowWords, 0);
+
+    // Group vertices by component with a counting sort.
+    std::vector<size_t> memberBegin(numComponents + 1, 0);
+    for (size_t c = 0; c < numComponents; ++c)
+        memberBegin[c + 1] = memberBegin[c] + static_cast<size_t>(componentSize[c]);
+    std::vector<int> members(numVertices);
+    std::vector<size_t> fill(memberBegin.begin(), memberBegin.end() - 1);
+    for (size_t v = 0; v < numVertices; ++v)
+        members[fill[static_cast<size_t>(component[v])]++] = static_cast<int>(v);
+
+    // lastSeen[d] == c once row d has been merged into row c, so parallel edges merge once.
+    std::vector<size_t> lastSeen(numComponents, numComponents);
+    for (size_t c = numComponents; c-- > 0;) {
+        std::uint64_t* row = closure.data() + c * rowWords;
+        row[c / 64] |= std::uint64_t(1) << (c % 64);
+
+        // Successors have higher numbers, so words before c / 64 stay zero in every row merged.
+        size_t firstWord = c / 64;
+        for (size_t i = memberBegin[c]; i < memberBegin[c + 1]; ++i) {
+            for (int w : graph.getNeighbors(static_cast<size_t>(members[i]))) {
+                size_t d = static_cast<size_t>(component[static_cast<size_t>(w)]);
+                if (d == c || lastSeen[d] == c)
+                    continue;
+                lastSeen[d] = c;
+                const std::uint64_t* successor = closure.data() + d * rowWords;
+                for (size_t word = firstWord; word < rowWords; ++word)
+                    row[word] |= successor[word];
+            }
+        }
+    }
+}
+
+size_t ReachabilityIndex::getNumVertices() const
+{
+    return numVertices;
+}
+
+size_t ReachabilityIndex::getNumComponents() const
+{
+    return numComponents;
+}
+
+int ReachabilityIndex::getComponent(size_t vertex) const
+{
+    if (vertex >= numVertices)
+        throw std::out_of_range("This index is out of range.");
+
+    return component[vertex];
+}
+
+bool ReachabilityIndex::canReach(size_t from, size_t to) const
+{
+    if (from >= numVertices || to >= numVertices)
+        throw std::out_of_range("One of these indices is out of range.");
+
+    size_t c = static_cast<size_t>(component[from]);
+    size_t d = static_cast<size_t>(component[to]);
+    // Topological numbering rejects every backward query without touching the closure.
+    if (d < c)
+        return false;
+    return (closure[c * rowWords + d / 64] >> (d % 64)) & 1;
+}
+
+bool ReachabilityIndex::areStronglyConnected(size_t u, size_t v) const
+{
+    if (u >= numVertices || v >= numVertices)
+        throw std::out_of_range("One of these indices is out of range.");
+
+    return component[u] == component[v];
+}
+
+size_t ReachabilityIndex::countReachable(size_t from) const
+{
+    if (from >= numVertices)
+        throw std::out_of_range("This index is out of range.");
+
+    size_t c = static_cast<size_t>(component[from]);
+    const std::uint64_t* row = closure.data() + c * rowWords;
+    size_t count = 0;
+    for (size_t word = c / 64; word < rowWords; ++word)
+        for (std::uint64_t bits = row[word]; bits != 0; bits &= bits - 1)
+            count += static_cast<size_t>(
+                componentSize[word * 64 + static_cast<size_t>(std::countr_zero(bits))]);
+    return count;
+}
+
+size_t ReachabilityIndex::getMemoryUsage() const
+{
+    return component.capacity() * sizeof(int) + componentSize.capacity() * sizeof(int)
+        + closure.capacity() * sizeof(std::uint64_t);
+}
+
+void ReachabilityIndex::save(std::ostream& out) const
+{
+    out.write(MAGIC, sizeof(MAGIC));
+    writeValue<std::uint32_t>(out, FORMAT_VERSION);
+    writeValue<std::uint64_t>(out, numVertices);
+    writeValue<std::uint64_t>(out, numComponents);
+
+    writeInts(out, component);
+    for (std::uint64_t word : closure)
+        writeValue<std::uint64_t>(out, word);
+
+    if (!out)
+        throw std::runtime_error("Failed to write reachability index.");
+}
+
+ReachabilityIndex ReachabilityIndex::load(std::istream& in)
+{
+    char magic[sizeof(MAGIC)];
+    if (!in.read(magic, sizeof(magic)) || !std::equal(magic, magic + sizeof(magic), MAGIC))
+        throw std::runtime_error("Stream does not contain a reachability index.");
+    if (readValue<std::uint32_t>(in) != FORMAT_VERSION)
+        throw std::runtime_error("Unsupported reachability index version.");
+
+    ReachabilityIndex index;
+    index.numVertices = readVertexCount(in);
+    index.numComponents = readValue<std::uint64_t>(in);
+    if (index.numComponents > index.numVertices)
+        throw std::runtime_error("Reachability index has more components than vertices.");
+
+    index.component = readInts(in, index.numVertices);
+    index.componentSize.assign(index.numComponents, 0);
+    for (int c : index.component) {
+        if (c < 0 || static_cast<size_t>(c) >= index.numComponents)
+            throw std::runtime_error("Reachability index contains an invalid component.");
+        ++index.componentSize[static_cast<size_t>(c)];
+    }
+    // Every component holds a vertex, so the closure size is backed by the component array.
+    if (std::find(index.componentSize.begin(), index.componentSize.end(), 0)
+        != index.componentSize.end())
+        throw std::runtime_error("Reachability index contains an empty component.");
+
+    index.rowWords = (index.numComponents + 63) / 64;
+    index.closure = readValues<std::uint64_t>(in, index.numComponents * index.rowWords);
+
+    return index;
+}
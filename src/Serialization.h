@@ -0,0 +1,100 @@
+#ifndef GRAPH_TOOLKIT_SERIALIZATION_H
+#define GRAPH_TOOLKIT_SERIALIZATION_H
+
+#include <algorithm>
+#include <cstdint>
+#include <istream>
+#include <limits>
+#include <ostream>
+#include <stdexcept>
+#include <vector>
+
+/**
+ * @brief Writes a trivially copyable value to a binary stream in host byte order.
+ * @param out Output stream.
+ * @param value Value to write.
+ */
+template <typename T> void writeValue(std::ostream& out, T value)
+{
+    out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+/**
+ * @brief Reads a trivially copyable value written by writeValue.
+ * @param in Input stream.
+ * @return The value read.
+ * @throws std::runtime_error if the stream ends early.
+ */
+template <typename T> T readValue(std::istream& in)
+{
+    T value {};
+    if (!in.read(reinterpret_cast<char*>(&value), sizeof(T)))
+        throw std::runtime_error("Stream is truncated.");
+    return value;
+}
+
+/**
+ * @brief Upper bound on the elements reserved ahead of the data. Vectors read from a stream grow
+ * as their values arrive, so a corrupt length fails on the truncated stream rather than in a huge
+ * allocation.
+ */
+inline constexpr size_t READ_RESERVE_LIMIT = size_t { 1 } << 16;
+
+/**
+ * @brief Reads a vertex count, which must fit the int vertex indices of the stored arrays.
+ * @param in Input stream.
+ * @return The count read.
+ * @throws std::runtime_error if the stream ends early or the count is out of range.
+ */
+inline size_t readVertexCount(std::istream& in)
+{
+    std::uint64_t count = readValue<std::uint64_t>(in);
+    if (count > static_cast<std::uint64_t>(std::numeric_limits<int>::max()))
+        throw std::runtime_error("Stream contains an invalid vertex count.");
+    return static_cast<size_t>(count);
+}
+
+/**
+ * @brief Reads size values written one by one with writeValue.
+ * @param in Input stream.
+ * @param size Number of values to read.
+ * @return The values read.
+ * @throws std::runtime_error if the stream ends early.
+ */
+template <typename T> std::vector<T> readValues(std::istream& in, size_t size)
+{
+    std::vector<T> values;
+    values.reserve(std::min(size, READ_RESERVE_LIMIT));
+    for (size_t i = 0; i < size; ++i)
+        values.push_back(readValue<T>(in));
+    return values;
+}
+
+/**
+ * @brief Writes a vector of ints as 32-bit values, without a length prefix.
+ * @param out Output stream.
+ * @param values Values to write.
+ */
+inline void writeInts(std::ostream& out, const std::vector<int>& values)
+{
+    for (int value : values)
+        writeValue<std::int32_t>(out, value);
+}
+
+/**
+ * @brief Reads a vector of ints written by writeInts.
+ * @param in Input stream.
+ * @param size Number of values to read.
+ * @return The values read.
+ * @throws std::runtime_error if the stream ends early.
+ */
+inline std::vector<int> readInts(std::istream& in, size_t size)
+{
+    std::vector<int> values;
+    values.reserve(std::min(size, READ_RESERVE_LIMIT));
+    for (size_t i = 0; i < size; ++i)
+        values.push_back(readValue<std::int32_t>(in));
+    return values;
+}
+
+#endif // GRAPH_TOOLKIT_SERIALIZATION_H
@@ -0,0 +1,298 @@
+#include "ShortestPathTree.h"
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+
+template <DistanceType Distance>
+BasicShortestPathTree<Distance>::BasicShortestPathTree(
+    std::vector<Distance> distances, const std::vector<int>& predecessors, size_t source)
+    : source(static_cast<std::int32_t>(source))
+    , dist(std::move(distances))
+    , layoutBuilt(false)
+{
+    if (dist.size() != predecessors.size())
+        throw std::invalid_argument("Distances and predecessors differ in size.");
+    if (source >= dist.size())
+        throw std::out_of_range("This index is out of range.");
+    if (dist.size() > static_cast<size_t>(std::numeric_limits<std::int32_t>::max()))
+        throw std::overflow_error("Graph has too many vertices for 32-bit ids.");
+
+    build(predecessors);
+}
+
+template <DistanceType Distance>
+BasicShortestPathTree<Distance>::BasicShortestPathTree(
+    const std::pair<std::vector<Distance>, std::vector<int>>& result, size_t source)
+    : BasicShortestPathTree(result.first, result.second, source)
+{
+}
+
+template <DistanceType Distance>
+BasicShortestPathTree<Distance>::BasicShortestPathTree(
+    const BasicShortestPathWorkspace<Distance>& workspace, size_t source)
+    : BasicShortestPathTree(workspace.distances(), workspace.predecessors(), source)
+{
+}
+
+template <DistanceType Distance>
+BasicShortestPathTree<Distance>::BasicShortestPathTree(const BasicShortestPathTree& other)
+    : source(other.source)
+    , dist(other.dist)
+    , parent(other.parent)
+{
+    std::lock_guard<std::mutex> lock(other.layoutMutex);
+    preorder = other.preorder;
+    preorderIndex = other.preorderIndex;
+    subtreeSize = other.subtreeSize;
+    layoutBuilt = other.layoutBuilt.load();
+}
+
+template <DistanceType Distance>
+BasicShortestPathTree<Distance>& BasicShortestPathTree<Distance>::operator=(
+    const BasicShortestPathTree& other)
+{
+    if (this != &other) {
+        source = other.source;
+        dist = other.dist;
+        parent = other.parent;
+
+        std::scoped_lock lock(layoutMutex, other.layoutMutex);
+        preorder = other.preorder;
+        preorderIndex = other.preorderIndex;
+        subtreeSize = other.subtreeSize;
+        layoutBuilt = other.layoutBuilt.load();
+    }
+    return *this;
+}
+
+template <DistanceType Distance>
+BasicShortestPathTree<Distance>::BasicShortestPathTree(BasicShortestPathTree&& other) noexcept
+    : source(other.source)
+    , dist(std::move(other.dist))
+    , parent(std::move(other.parent))
+    , preorder(std::move(other.preorder))
+    , preorderIndex(std::move(other.preorderIndex))
+    , subtreeSize(std::move(other.subtreeSize))
+    , layoutBuilt(other.layoutBuilt.load())
+{
+    other.layoutBuilt = false;
+}
+
+template <DistanceType Distance>
+BasicShortestPathTree<Distance>& BasicShortestPathTree<Distance>::operator=(
+    BasicShortestPathTree&& other) noexcept
+{
+    if (this != &other) {
+        source = other.source;
+        dist = std::move(other.dist);
+        parent = std::move(other.parent);
+        preorder = std::move(other.preorder);
+        preorderIndex = std::move(other.preorderIndex);
+        subtreeSize = std::move(other.subtreeSize);
+        layoutBuilt = other.layoutBuilt.load();
+        other.layoutBuilt = false;
+    }
+    return *this;
+}
+
+template <DistanceType Distance>
+bool BasicShortestPathTree<Distance>::validVertex(size_t vertex) const noexcept
+{
+    return vertex < parent.size();
+}
+
+template <DistanceType Distance>
+void BasicShortestPathTree<Distance>::build(const std::vector<int>& predecessors)
+{
+    size_t n = predecessors.size();
+    if (predecessors[static_cast<size_t>(source)] != -1)
+        throw std::invalid_argument("The source cannot have a predecessor.");
+    for (int p : predecessors)
+        if (p < -1 || p >= static_cast<int>(n))
+            throw std::invalid_argument("Predecessor is out of range.");
+    parent.assign(predecessors.begin(), predecessors.end());
+
+    // Every vertex with a parent must lead up to the source; each is walked once, so this is O(V).
+    // 0 = not walked yet, 1 = on the current walk, 2 = known to lead to the source.
+    std::vector<std::uint8_t> state(n, 0);
+    state[static_cast<size_t>(source)] = 2;
+    std::vector<std::int32_t> walk;
+    for (size_t v = 0; v < n; ++v) {
+        if (parent[v] < 0 || state[v] == 2)
+            continue;
+        walk.clear();
+        size_t u = v;
+        while (state[u] == 0 && parent[u] >= 0) {
+            state[u] = 1;
+            walk.push_back(static_cast<std::int32_t>(u));
+            u = static_cast<size_t>(parent[u]);
+        }
+        // Stopping on the current walk means a cycle; stopping at another root means a forest.
+        if (state[u] != 2)
+            throw std::invalid_argument("Predecessors do not form a tree rooted at the source.");
+        for (std::int32_t w : walk)
+            state[static_cast<size_t>(w)] = 2;
+    }
+}
+
+template <DistanceType Distance> void BasicShortestPathTree<Distance>::buildLayout() const
+{
+    if (layoutBuilt.load(std::memory_order_acquire))
+        return;
+
+    std::lock_guard<std::mutex> lock(layoutMutex);
+    if (layoutBuilt.load(std::memory_order_relaxed))
+        return;
+
+    // Children grouped by parent, CSR-style, so the tree can be walked top-down.
+    size_t n = parent.size();
+    std::vector<std::int32_t> childBegin(n + 1, 0);
+    for (std::int32_t p : parent)
+        if (p >= 0)
+            ++childBegin[static_cast<size_t>(p) + 1];
+    for (size_t v = 0; v < n; ++v)
+        childBegin[v + 1] += childBegin[v];
+    std::vector<std::int32_t> children(static_cast<size_t>(childBegin[n]));
+    std::vector<std::int32_t> fill(childBegin.begin(), childBegin.end() - 1);
+    for (size_t v = 0; v < n; ++v)
+        if (parent[v] >= 0)
+            children[static_cast<size_t>(fill[static_cast<size_t>(parent[v])]++)]
+                = static_cast<std::int32_t>(v);
+
+    preorderIndex.assign(n, -1);
+    subtreeSize.assign(n, 0);
+    preorder.clear();
+    preorder.reserve(n);
+
+    std::vector<std::int32_t> stack { source };
+    while (!stack.empty()) {
+        std::int32_t vertex = stack.back();
+        stack.pop_back();
+        preorderIndex[static_cast<size_t>(vertex)] = static_cast<std::int32_t>(preorder.size());
+        preorder.push_back(vertex);
+        for (std::int32_t i = childBegin[static_cast<size_t>(vertex) + 1];
+             i > childBegin[static_cast<size_t>(vertex)]; --i)
+            stack.push_back(children[static_cast<size_t>(i - 1)]);
+    }
+
+    for (size_t i = preorder.size(); i-- > 0;) {
+        size_t vertex = static_cast<size_t>(preorder[i]);
+        ++subtreeSize[vertex];
+        if (parent[vertex] >= 0)
+            subtreeSize[static_cast<size_t>(parent[vertex])] += subtreeSize[vertex];
+    }
+    layoutBuilt.store(true, std::memory_order_release);
+}
+
+template <DistanceType Distance>
+int BasicShortestPathTree<Distance>::walkDepth(size_t vertex) const noexcept
+{
+    int edges = 0;
+    for (std::int32_t v = static_cast<std::int32_t>(vertex); v != source;
+         v = parent[static_cast<size_t>(v)])
+        ++edges;
+    return edges;
+}
+
+template <DistanceType Distance> size_t BasicShortestPathTree<Distance>::getNumVertices() const
+{
+    return parent.size();
+}
+
+template <DistanceType Distance> size_t BasicShortestPathTree<Distance>::getSource() const
+{
+    return static_cast<size_t>(source);
+}
+
+template <DistanceType Distance>
+bool BasicShortestPathTree<Distance>::isReachable(size_t vertex) const
+{
+    if (!validVertex(vertex))
+        throw std::out_of_range("This index is out of range.");
+
+    return static_cast<std::int32_t>(vertex) == source || parent[vertex] >= 0;
+}
+
+template <DistanceType Distance>
+Distance BasicShortestPathTree<Distance>::getDistance(size_t vertex) const
+{
+    if (!validVertex(vertex))
+        throw std::out_of_range("This index is out of range.");
+
+    return dist[vertex];
+}
+
+template <DistanceType Distance> int BasicShortestPathTree<Distance>::getParent(size_t vertex) const
+{
+    if (!validVertex(vertex))
+        throw std::out_of_range("This index is out of range.");
+
+    return parent[vertex];
+}
+
+template <DistanceType Distance> int BasicShortestPathTree<Distance>::getDepth(size_t vertex) const
+{
+    if (!isReachable(vertex))
+        return -1;
+
+    return walkDepth(vertex);
+}
+
+template <DistanceType Distance>
+typename BasicShortestPathTree<Distance>::PathView BasicShortestPathTree<Distance>::path(
+    size_t target) const
+{
+    if (!isReachable(target))
+        return { PathIterator(), 0 };
+    return { PathIterator(parent.data(), static_cast<std::int32_t>(target)),
+        static_cast<size_t>(walkDepth(target)) + 1 };
+}
+
+template <DistanceType Distance>
+void BasicShortestPathTree<Distance>::copyPath(size_t target, std::vector<int>& out) const
+{
+    PathView view = path(target);
+    out.resize(view.size());
+    size_t position = view.size();
+    for (int vertex : view)
+        out[--position] = vertex;
+}
+
+template <DistanceType Distance>
+bool BasicShortestPathTree<Distance>::isAncestor(size_t ancestor, size_t vertex) const
+{
+    if (!validVertex(ancestor) || !validVertex(vertex))
+        throw std::out_of_range("One of these indices is out of range.");
+
+    buildLayout();
+    std::int32_t first = preorderIndex[ancestor];
+    std::int32_t position = preorderIndex[vertex];
+    return first >= 0 && position >= first && position < first + subtreeSize[ancestor];
+}
+
+template <DistanceType Distance>
+std::span<const std::int32_t> BasicShortestPathTree<Distance>::subtree(size_t root) const
+{
+    if (!validVertex(root))
+        throw std::out_of_range("This index is out of range.");
+
+    buildLayout();
+    if (preorderIndex[root] < 0)
+        return {};
+    return std::span<const std::int32_t>(preorder).subspan(
+        static_cast<size_t>(preorderIndex[root]), static_cast<size_t>(subtreeSize[root]));
+}
+
+template <DistanceType Distance> size_t BasicShortestPathTree<Distance>::getMemoryUsage() const
+{
+    size_t bytes = dist.size() * sizeof(Distance) + parent.size() * sizeof(std::int32_t);
+    if (layoutBuilt.load(std::memory_order_acquire))
+        bytes += (preorder.size() + preorderIndex.size() + subtreeSize.size())
+            * sizeof(std::int32_t);
+    return bytes;
+}
+
+template class BasicShortestPathTree<int>;
+template class BasicShortestPathTree<std::int64_t>;
+template class BasicShortestPathTree<float>;
+template class BasicShortestPathTree<double>;
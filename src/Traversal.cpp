@@ -0,0 +1,294 @@
+#include "Traversal.h"
+#include "Parallel.h"
+#include <algorithm>
+#include <atomic>
+#include <barrier>
+#include <bit>
+#include <cstdint>
+#include <stdexcept>
+
+namespace {
+
+using Bitmap = std::vector<std::uint64_t>;
+
+Bitmap makeBitmap(size_t bits)
+{
+    return Bitmap((bits + 63) / 64, 0);
+}
+
+bool testBit(const Bitmap& bitmap, size_t bit)
+{
+    return (bitmap[bit / 64] >> (bit % 64)) & 1;
+}
+
+void setBit(Bitmap& bitmap, size_t bit)
+{
+    bitmap[bit / 64] |= std::uint64_t(1) << (bit % 64);
+}
+
+void clearBit(Bitmap& bitmap, size_t bit)
+{
+    bitmap[bit / 64] &= ~(std::uint64_t(1) << (bit % 64));
+}
+
+// Frontier vertices handed to a parallel BFS worker at a time.
+const size_t FRONTIER_CHUNK = 64;
+
+// Sources sharing one multi-source BFS, one bit each.
+const size_t BATCH_WIDTH = 64;
+
+/**
+ * Runs one MS-BFS batch: bit i of a vertex's words belongs to sources[first + i].
+ */
+void multiSourceBatch(const CsrGraph& graph, const std::vector<int>& sources, size_t first,
+    std::vector<std::vector<int>>& levels, Bitmap& seen, Bitmap& visit, Bitmap& visitNext)
+{
+    size_t n = graph.getNumVertices();
+    size_t width = std::min(BATCH_WIDTH, sources.size() - first);
+    std::fill(seen.begin(), seen.end(), 0);
+    std::fill(visit.begin(), visit.end(), 0);
+    std::fill(visitNext.begin(), visitNext.end(), 0);
+
+    for (size_t i = 0; i < width; ++i) {
+        size_t source = static_cast<size_t>(sources[first + i]);
+        seen[source] |= std::uint64_t(1) << i;
+        visit[source] |= std::uint64_t(1) << i;
+        levels[first + i].assign(n, -1);
+        levels[first + i][source] = 0;
+    }
+
+    for (int level = 1;; ++level) {
+        bool active = false;
+        for (size_t v = 0; v < n; ++v) {
+            if (visit[v] == 0)
+                continue;
+            for (int next : graph.getNeighbors(v))
+                visitNext[static_cast<size_t>(next)] |= visit[v];
+        }
+
+        for (size_t v = 0; v < n; ++v) {
+            std::uint64_t reached = visitNext[v] & ~seen[v];
+            visitNext[v] = 0;
+            visit[v] = reached;
+            if (reached == 0)
+                continue;
+            active = true;
+            seen[v] |= reached;
+            for (; reached != 0; reached &= reached - 1)
+                levels[first + static_cast<size_t>(std::countr_zero(reached))][v] = level;
+        }
+
+        if (!active)
+            break;
+    }
+}
+
+} // namespace
+
+BreadthFirstResult directionOptimizingBfs(
+    const CsrGraph& graph, const CsrGraph& reverse, size_t source, size_t alpha, size_t beta)
+{
+    size_t n = graph.getNumVertices();
+    if (source >= n)
+        throw std::out_of_range("This index is out of range.");
+    if (reverse.getNumVertices() != n)
+        throw std::invalid_argument("Reverse graph has a different number of vertices.");
+    if (alpha == 0 || beta == 0)
+        throw std::invalid_argument("Direction switch parameters must be positive.");
+
+    BreadthFirstResult result;
+    result.levels.assign(n, -1);
+    result.parents.assign(n, -1);
+    result.order.reserve(n);
+
+    Bitmap visited = makeBitmap(n);
+    Bitmap frontier = makeBitmap(n);
+    auto discover = [&](size_t vertex, size_t parent, int level) {
+        setBit(visited, vertex);
+        result.levels[vertex] = level;
+        result.parents[vertex] = static_cast<int>(parent);
+        result.order.push_back(static_cast<int>(vertex));
+    };
+
+    setBit(visited, source);
+    result.levels[source] = 0;
+    result.order.push_back(static_cast<int>(source));
+    size_t unexploredEdges = graph.getNumEdges() - graph.getNeighbors(source).size();
+
+    // The frontier is always the last level's slice of order; bottom-up steps mirror it in a
+    // bitmap so that membership tests on in-neighbors are O(1).
+    bool bottomUp = false;
+    size_t previousSize = 0;
+    size_t levelBegin = 0;
+    for (int level = 1; levelBegin < result.order.size(); ++level) {
+        size_t levelEnd = result.order.size();
+        size_t frontierSize = levelEnd - levelBegin;
+
+        if (!bottomUp) {
+            size_t frontierEdges = 0;
+            for (size_t i = levelBegin; i < levelEnd; ++i)
+                frontierEdges += graph.getNeighbors(static_cast<size_t>(result.order[i])).size();
+            bottomUp = frontierEdges > unexploredEdges / alpha;
+        } else if (frontierSize < previousSize && frontierSize < n / beta) {
+            bottomUp = false;
+        }
+
+        if (bottomUp) {
+            for (size_t i = levelBegin; i < levelEnd; ++i)
+                setBit(frontier, static_cast<size_t>(result.order[i]));
+
+            for (size_t word = 0; word < visited.size(); ++word) {
+                for (std::uint64_t pending = ~visited[word]; pending != 0; pending &= pending - 1) {
+                    size_t vertex = word * 64 + static_cast<size_t>(std::countr_zero(pending));
+                    if (vertex >= n)
+                        break;
+                    for (int parent : reverse.getNeighbors(vertex)) {
+                        if (testBit(frontier, static_cast<size_t>(parent))) {
+                            discover(vertex, static_cast<size_t>(parent), level);
+                            break;
+                        }
+                    }
+                }
+            }
+
+            for (size_t i = levelBegin; i < levelEnd; ++i)
+                clearBit(frontier, static_cast<size_t>(result.order[i]));
+        } else {
+            for (size_t i = levelBegin; i < levelEnd; ++i) {
+                size_t vertex = static_cast<size_t>(result.order[i]);
+                for (int next : graph.getNeighbors(vertex))
+                    if (!testBit(visited, static_cast<size_t>(next)))
+                        discover(static_cast<size_t>(next), vertex, level);
+            }
+        }
+
+        for (size_t i = levelEnd; i < result.order.size(); ++i)
+            unexploredEdges -= graph.getNeighbors(static_cast<size_t>(result.order[i])).size();
+        previousSize = frontierSize;
+        levelBegin = levelEnd;
+    }
+
+    return result;
+}
+
+BreadthFirstResult directionOptimizingBfs(const CsrGraph& graph, size_t source)
+{
+    if (source >= graph.getNumVertices())
+        throw std::out_of_range("This index is out of range.");
+
+    return directionOptimizingBfs(graph, graph.transpose(), source);
+}
+
+BreadthFirstResult directionOptimizingBfs(const Graph& graph, size_t source)
+{
+    return directionOptimizingBfs(CsrGraph(graph), source);
+}
+
+BreadthFirstResult parallelBfs(const CsrGraph& graph, size_t source, size_t numThreads)
+{
+    size_t n = graph.getNumVertices();
+    if (source >= n)
+        throw std::out_of_range("This index is out of range.");
+
+    BreadthFirstResult result;
+    result.levels.assign(n, -1);
+    result.parents.assign(n, -1);
+    result.order.assign(n, -1);
+
+    std::vector<std::atomic<std::uint64_t>> visited((n + 63) / 64);
+    auto claim = [&visited](size_t vertex) {
+        std::uint64_t bit = std::uint64_t(1) << (vertex % 64);
+        std::atomic<std::uint64_t>& word = visited[vertex / 64];
+        // The plain load filters most already-visited vertices without a read-modify-write.
+        if (word.load(std::memory_order_relaxed) & bit)
+            return false;
+        return (word.fetch_or(bit, std::memory_order_relaxed) & bit) == 0;
+    };
+
+    claim(source);
+    result.levels[source] = 0;
+    result.order[0] = static_cast<int>(source);
+
+    size_t threads = resolveThreadCount(numThreads, n);
+    std::vector<std::vector<int>> discovered(threads);
+    std::vector<size_t> writeOffset(threads + 1);
+    std::atomic<size_t> nextChunk { 0 };
+    size_t levelBegin = 0;
+    size_t levelEnd = 1;
+    int level = 1;
+    bool done = false;
+
+    auto placeDiscoveries = [&]() noexcept {
+        writeOffset[0] = levelEnd;
+        for (size_t t = 0; t < threads; ++t)
+            writeOffset[t + 1] = writeOffset[t] + discovered[t].size();
+    };
+    auto advanceLevel = [&]() noexcept {
+        for (std::vector<int>& buffer : discovered)
+            buffer.clear();
+        levelBegin = levelEnd;
+        levelEnd = writeOffset[threads];
+        nextChunk = levelBegin;
+        ++level;
+        done = levelBegin == levelEnd;
+    };
+    std::barrier expanded(static_cast<std::ptrdiff_t>(threads), placeDiscoveries);
+    std::barrier merged(static_cast<std::ptrdiff_t>(threads), advanceLevel);
+
+    runWorkers(threads, [&](size_t worker) {
+        std::vector<int>& local = discovered[worker];
+        while (!done) {
+            for (size_t begin = nextChunk.fetch_add(FRONTIER_CHUNK); begin < levelEnd;
+                 begin = nextChunk.fetch_add(FRONTIER_CHUNK)) {
+                size_t end = std::min(begin + FRONTIER_CHUNK, levelEnd);
+                for (size_t i = begin; i < end; ++i) {
+                    int vertex = result.order[i];
+                    for (int next : graph.getNeighbors(static_cast<size_t>(vertex))) {
+                        if (claim(static_cast<size_t>(next))) {
+                            result.levels[static_cast<size_t>(next)] = level;
+                            result.parents[static_cast<size_t>(next)] = vertex;
+                            local.push_back(next);
+                        }
+                    }
+                }
+            }
+            expanded.arrive_and_wait();
+
+            std::copy(local.begin(), local.end(),
+                result.order.begin() + static_cast<std::ptrdiff_t>(writeOffset[worker]));
+            merged.arrive_and_wait();
+        }
+    });
+
+    result.order.resize(levelEnd);
+    return result;
+}
+
+std::vector<std::vector<int>> multiSourceBfs(
+    const CsrGraph& graph, const std::vector<int>& sources, size_t numThreads)
+{
+    size_t n = graph.getNumVertices();
+    for (int source : sources)
+        if (source < 0 || static_cast<size_t>(source) >= n)
+            throw std::out_of_range("Source vertex is out of range.");
+
+    std::vector<std::vector<int>> levels(sources.size());
+    size_t batches = (sources.size() + BATCH_WIDTH - 1) / BATCH_WIDTH;
+    size_t threads = resolveThreadCount(numThreads, batches);
+
+    // One set of per-vertex words per worker, reused for all of its batches.
+    std::vector<Bitmap> seen(threads, Bitmap(n)), visit(threads, Bitmap(n)),
+        visitNext(threads, Bitmap(n));
+    parallelFor(batches, threads, [&](size_t worker, size_t batch) {
+        multiSourceBatch(graph, sources, batch * BATCH_WIDTH, levels, seen[worker], visit[worker],
+            visitNext[worker]);
+    });
+
+    return levels;
+}
+
+std::vector<std::vector<int>> multiSourceBfs(
+    const Graph& graph, const std::vector<int>& sources, size_t numThreads)
+{
+    return multiSourceBfs(CsrGraph(graph), sources, numThreads);
+}
@@ -0,0 +1,134 @@
+#include "UnionFind.h"
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+
+ConcurrentUnionFind::ConcurrentUnionFind()
+    : ConcurrentUnionFind(0)
+{
+}
+
+ConcurrentUnionFind::ConcurrentUnionFind(size_t size)
+    : numSets(0)
+{
+    reset(size);
+}
+
+ConcurrentUnionFind::ConcurrentUnionFind(const ConcurrentUnionFind& other)
+    : parent(other.parent.size())
+    , numSets(other.numSets.load())
+{
+    for (size_t i = 0; i < parent.size(); ++i)
+        parent[i].store(other.parent[i].load(std::memory_order_relaxed), std::memory_order_relaxed);
+}
+
+ConcurrentUnionFind& ConcurrentUnionFind::operator=(const ConcurrentUnionFind& other)
+{
+    if (this != &other) {
+        ConcurrentUnionFind copy(other);
+        *this = std::move(copy);
+    }
+    return *this;
+}
+
+ConcurrentUnionFind::ConcurrentUnionFind(ConcurrentUnionFind&& other) noexcept
+    : parent(std::move(other.parent))
+    , numSets(other.numSets.exchange(0))
+{
+}
+
+ConcurrentUnionFind& ConcurrentUnionFind::operator=(ConcurrentUnionFind&& other) noexcept
+{
+    if (this != &other) {
+        parent = std::move(other.parent);
+        numSets = other.numSets.exchange(0);
+    }
+    return *this;
+}
+
+size_t ConcurrentUnionFind::getSize() const
+{
+    return parent.size();
+}
+
+size_t ConcurrentUnionFind::getNumSets() const
+{
+    return numSets.load();
+}
+
+int ConcurrentUnionFind::find(size_t element) const
+{
+    if (element >= parent.size())
+        throw std::out_of_range("This index is out of range.");
+
+    int x = static_cast<int>(element);
+    while (true) {
+        int p = parent[static_cast<size_t>(x)].load(std::memory_order_relaxed);
+        if (p == x)
+            return x;
+        int grandparent = parent[static_cast<size_t>(p)].load(std::memory_order_relaxed);
+        // Path halving: skip a level. A failed exchange means another thread already moved x up.
+        if (grandparent != p)
+            parent[static_cast<size_t>(x)].compare_exchange_weak(
+                p, grandparent, std::memory_order_relaxed);
+        x = grandparent;
+    }
+}
+
+bool ConcurrentUnionFind::unite(size_t a, size_t b)
+{
+    if (a >= parent.size() || b >= parent.size())
+        throw std::out_of_range("One of these indices is out of range.");
+
+    while (true) {
+        int rootA = find(a);
+        int rootB = find(b);
+        if (rootA == rootB)
+            return false;
+
+        // Parents always point to smaller elements, so concurrent links can never form a cycle.
+        int high = std::max(rootA, rootB);
+        int low = std::min(rootA, rootB);
+        int expected = high;
+        if (parent[static_cast<size_t>(high)].compare_exchange_strong(
+                expected, low, std::memory_order_relaxed)) {
+            numSets.fetch_sub(1);
+            return true;
+        }
+    }
+}
+
+bool ConcurrentUnionFind::connected(size_t a, size_t b) const
+{
+    if (a >= parent.size() || b >= parent.size())
+        throw std::out_of_range("One of these indices is out of range.");
+
+    while (true) {
+        int rootA = find(a);
+        int rootB = find(b);
+        if (rootA == rootB)
+            return true;
+        // If rootA is still a root after rootB was found, the sets were distinct at that moment.
+        if (parent[static_cast<size_t>(rootA)].load(std::memory_order_relaxed) == rootA)
+            return false;
+    }
+}
+
+void ConcurrentUnionFind::addElement()
+{
+    std::vector<std::atomic<int>> grown(parent.size() + 1);
+    for (size_t i = 0; i < parent.size(); ++i)
+        grown[i].store(parent[i].load(std::memory_order_relaxed), std::memory_order_relaxed);
+    grown.back().store(static_cast<int>(parent.size()), std::memory_order_relaxed);
+    parent.swap(grown);
+    numSets.fetch_add(1);
+}
+
+void ConcurrentUnionFind::reset(size_t size)
+{
+    std::vector<std::atomic<int>> fresh(size);
+    for (size_t i = 0; i < size; ++i)
+        fresh[i].store(static_cast<int>(i), std::memory_order_relaxed);
+    parent.swap(fresh);
+    numSets = size;
+}
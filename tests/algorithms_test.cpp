@@ -1,6 +1,8 @@
 #include "../include/Algorithms.h"
+#include <algorithm>
 #include <gtest/gtest.h>
 #include <limits>
+#include <set>
 
 class AlgorithmsTest : public ::testing::Test { };
 
@@ -78,6 +80,188 @@ TEST_F(AlgorithmsTest, Dijkstra_PredecessorChain)
     EXPECT_EQ(pred[0], -1);
 }
 
+// --- Workspace and Batch Tests ---
+
+TEST_F(AlgorithmsTest, Workspace_ReuseAcrossSources)
+{
+    Graph g(6, true);
+    g.addEdge(0, 1, 7);
+    g.addEdge(0, 2, 9);
+    g.addEdge(0, 5, 14);
+    g.addEdge(1, 2, 10);
+    g.addEdge(1, 3, 15);
+    g.addEdge(2, 3, 11);
+    g.addEdge(2, 5, 2);
+    g.addEdge(3, 4, 6);
+    g.addEdge(4, 5, 9);
+
+    CsrGraph csr(g);
+    ShortestPathWorkspace workspace;
+
+    // Run from a far source first so stale entries would leak into later runs if not reset.
+    for (size_t source : { 0, 4, 2, 0 }) {
+        dijkstra(csr, source, workspace);
+        auto [dist, pred] = dijkstra(g, source);
+
+        EXPECT_EQ(workspace.distances(), dist);
+        EXPECT_EQ(workspace.predecessors(), pred);
+        for (size_t v = 0; v < 6; ++v)
+            EXPECT_EQ(workspace.getDistance(v), dist[v]);
+
+        // Settle order is non-decreasing in distance and covers exactly the reachable set.
+        const std::vector<int>& settled = workspace.getSettled();
+        for (size_t i = 1; i < settled.size(); ++i)
+            EXPECT_LE(dist[static_cast<size_t>(settled[i - 1])],
+                dist[static_cast<size_t>(settled[i])]);
+        size_t reachable = 0;
+        for (int d : dist)
+            reachable += d != std::numeric_limits<int>::max() ? 1 : 0;
+        EXPECT_EQ(settled.size(), reachable);
+    }
+
+    EXPECT_THROW(workspace.getDistance(6), std::out_of_range);
+    EXPECT_THROW(dijkstra(csr, 6, workspace), std::out_of_range);
+}
+
+TEST_F(AlgorithmsTest, BatchDijkstra_MatchesSingleSource)
+{
+    Graph g(30, true);
+    for (size_t i = 0; i < 30; ++i) {
+        g.addEdge(i, (i + 1) % 30, static_cast<int>(i % 7) + 1);
+        g.addEdge(i, (i * 7 + 3) % 30, static_cast<int>(i % 5) + 2);
+    }
+
+    std::vector<int> sources = { 0, 5, 5, 17, 29, 12 };
+    std::vector<std::vector<int>> matrix = batchDijkstra(g, sources, 3);
+
+    ASSERT_EQ(matrix.size(), sources.size());
+    for (size_t i = 0; i < sources.size(); ++i)
+        EXPECT_EQ(matrix[i], dijkstra(g, static_cast<size_t>(sources[i])).first);
+}
+
+TEST_F(AlgorithmsTest, BatchDijkstra_StreamsEverySource)
+{
+    Graph g(10, true);
+    for (size_t i = 0; i + 1 < 10; ++i)
+        g.addUndirectedEdge(i, i + 1, 2);
+
+    std::vector<int> sources(10);
+    for (size_t i = 0; i < 10; ++i)
+        sources[i] = static_cast<int>(i);
+
+    std::vector<int> eccentricity(sources.size(), -1);
+    batchDijkstra(
+        CsrGraph(g), sources,
+        [&eccentricity](size_t i, const ShortestPathWorkspace& workspace) {
+            int farthest = workspace.getSettled().back();
+            eccentricity[i] = workspace.getDistance(static_cast<size_t>(farthest));
+        },
+        4);
+
+    for (size_t i = 0; i < 10; ++i)
+        EXPECT_EQ(eccentricity[i], 2 * static_cast<int>(std::max(i, 9 - i)));
+
+    EXPECT_THROW(batchDijkstra(g, { 0, 10 }), std::out_of_range);
+    EXPECT_TRUE(batchDijkstra(g, {}).empty());
+}
+
+// --- A* Tests ---
+
+TEST_F(AlgorithmsTest, AStar_ZeroHeuristicMatchesDijkstra)
+{
+    Graph g(5, true);
+    g.addEdge(0, 1, 10);
+    g.addEdge(0, 3, 5);
+    g.addEdge(1, 2, 1);
+    g.addEdge(1, 3, 2);
+    g.addEdge(2, 4, 4);
+    g.addEdge(3, 1, 3);
+    g.addEdge(3, 2, 9);
+    g.addEdge(3, 4, 2);
+    g.addEdge(4, 2, 6);
+
+    auto [distD, predD] = dijkstra(g, 0);
+    for (size_t target = 0; target < 5; ++target) {
+        auto [dist, pred] = aStar(g, 0, target, [](size_t) { return 0; });
+        EXPECT_EQ(dist[target], distD[target]);
+    }
+}
+
+TEST_F(AlgorithmsTest, AStar_EuclideanGrid)
+{
+    // 4x4 grid with unit spacing scaled by 10; every edge weight is at least its length.
+    const size_t side = 4;
+    Graph g(side * side, true);
+    std::vector<std::pair<double, double>> coordinates;
+    for (size_t r = 0; r < side; ++r)
+        for (size_t c = 0; c < side; ++c)
+            coordinates.push_back({ 10.0 * c, 10.0 * r });
+
+    for (size_t r = 0; r < side; ++r) {
+        for (size_t c = 0; c < side; ++c) {
+            size_t v = r * side + c;
+            if (c + 1 < side)
+                g.addUndirectedEdge(v, v + 1, 10 + static_cast<int>(r));
+            if (r + 1 < side)
+                g.addUndirectedEdge(v, v + side, 10 + static_cast<int>(c));
+        }
+    }
+
+    size_t target = side * side - 1;
+    auto [distD, predD] = dijkstra(g, 0);
+    auto [dist, pred] = aStar(g, 0, target, euclideanHeuristic(coordinates, target));
+
+    EXPECT_EQ(dist[target], distD[target]);
+
+    // The predecessor chain must be a valid path of the reported length.
+    int length = 0;
+    for (size_t v = target; pred[v] != -1; v = static_cast<size_t>(pred[v]))
+        length += g.getEdgeWeight(static_cast<size_t>(pred[v]), v);
+    EXPECT_EQ(length, dist[target]);
+}
+
+TEST_F(AlgorithmsTest, AStar_LandmarkHeuristic)
+{
+    Graph g(6, true);
+    g.addEdge(0, 1, 7);
+    g.addEdge(0, 2, 9);
+    g.addEdge(0, 5, 14);
+    g.addEdge(1, 2, 10);
+    g.addEdge(1, 3, 15);
+    g.addEdge(2, 3, 11);
+    g.addEdge(2, 5, 2);
+    g.addEdge(3, 4, 6);
+    g.addEdge(4, 5, 9);
+
+    std::vector<std::vector<int>> tables = { dijkstra(g, 0).first, dijkstra(g, 1).first };
+    auto [distD, predD] = dijkstra(g, 0);
+
+    for (size_t target = 0; target < 6; ++target) {
+        auto [dist, pred] = aStar(g, 0, target, landmarkHeuristic(tables, target));
+        EXPECT_EQ(dist[target], distD[target]);
+    }
+}
+
+TEST_F(AlgorithmsTest, AStar_UnreachableAndOutOfRange)
+{
+    Graph g(3, true);
+    g.addEdge(0, 1, 5);
+
+    auto [dist, pred] = aStar(g, 0, 2, [](size_t) { return 0; });
+    EXPECT_EQ(dist[2], std::numeric_limits<int>::max());
+    EXPECT_EQ(pred[2], -1);
+
+    EXPECT_THROW(aStar(g, 0, 3, [](size_t) { return 0; }), std::out_of_range);
+    EXPECT_THROW(aStar(g, 3, 0, [](size_t) { return 0; }), std::out_of_range);
+    EXPECT_THROW(euclideanHeuristic({ { 0.0, 0.0 } }, 1), std::out_of_range);
+
+    // Heuristics built for fewer vertices than the graph has fail when the search reaches them.
+    g.addEdge(1, 2, 5);
+    EXPECT_THROW(aStar(g, 0, 2, euclideanHeuristic({ { 0.0, 0.0 }, { 1.0, 0.0 } }, 1)),
+        std::out_of_range);
+    EXPECT_THROW(landmarkHeuristic({ { 0, 5 } }, 1)(2), std::out_of_range);
+}
+
 // --- Bellman-Ford Tests ---
 
 TEST_F(AlgorithmsTest, BellmanFord_DirectedWeightedGraph)
@@ -154,6 +338,109 @@ TEST_F(AlgorithmsTest, BellmanFord_SourceOutOfRange)
     EXPECT_THROW(bellmanFord(g, 10), std::out_of_range);
 }
 
+TEST_F(AlgorithmsTest, BellmanFord_ModesAgreeWithNegativeEdges)
+{
+    CsrGraph g(6,
+        { { 0, 1, 4 }, { 0, 2, 5 }, { 1, 3, -2 }, { 2, 1, -3 }, { 3, 4, 3 }, { 4, 5, -1 },
+            { 2, 5, 8 } });
+
+    auto [dist, pred] = bellmanFord(g, 0, BellmanFordMode::FullPasses);
+    EXPECT_EQ(dist, (std::vector<int> { 0, 2, 5, 0, 3, 2 })); // 0->2->1->3->4->5
+    EXPECT_EQ(pred[1], 2);
+
+    for (BellmanFordMode mode : { BellmanFordMode::EarlyExit, BellmanFordMode::Queue }) {
+        auto [modeDist, modePred] = bellmanFord(g, 0, mode);
+        EXPECT_EQ(modeDist, dist);
+        EXPECT_EQ(modePred, pred);
+    }
+}
+
+TEST_F(AlgorithmsTest, BellmanFord_NegativeCycleDetectedInEveryMode)
+{
+    CsrGraph g(4, { { 0, 1, 1 }, { 1, 2, -1 }, { 2, 3, -1 }, { 3, 1, 1 } });
+
+    for (BellmanFordMode mode :
+        { BellmanFordMode::FullPasses, BellmanFordMode::EarlyExit, BellmanFordMode::Queue })
+        EXPECT_THROW(bellmanFord(g, 0, mode), std::runtime_error);
+
+    // A negative cycle unreachable from the source is not an error.
+    CsrGraph unreachable(3, { { 1, 2, -2 }, { 2, 1, 1 } });
+    EXPECT_EQ(bellmanFord(unreachable, 0, BellmanFordMode::Queue).first[1],
+        std::numeric_limits<int>::max());
+}
+
+TEST_F(AlgorithmsTest, BellmanFord_ModesMatchDijkstraOnRandomGraph)
+{
+    Graph g(40, true);
+    for (size_t i = 0; i < 40; ++i) {
+        g.addEdge(i, (i * 11 + 5) % 40, static_cast<int>(i % 9) + 1);
+        g.addEdge(i, (i * 3 + 1) % 40, static_cast<int>(i % 4) + 3);
+    }
+
+    std::vector<int> expected = dijkstra(g, 0).first;
+    for (BellmanFordMode mode :
+        { BellmanFordMode::FullPasses, BellmanFordMode::EarlyExit, BellmanFordMode::Queue })
+        EXPECT_EQ(bellmanFord(g, 0, mode).first, expected);
+}
+
+TEST_F(AlgorithmsTest, ParallelBellmanFord_MatchesSequential)
+{
+    // Difference-constraint style graph with negative edges but no negative cycle.
+    std::vector<CsrGraph::Edge> edges;
+    for (int i = 0; i < 60; ++i) {
+        edges.push_back({ i, (i + 1) % 60, 5 });
+        edges.push_back({ i, (i * 7 + 3) % 60, (i % 4) - 1 + (i % 7) });
+    }
+    CsrGraph g(60, edges);
+
+    std::vector<int> expected = bellmanFord(g, 0).first;
+    for (size_t threads : { 1, 2, 3, 8 }) {
+        auto [dist, pred] = parallelBellmanFord(g, 0, threads);
+        EXPECT_EQ(dist, expected);
+
+        // Every predecessor edge must be tight.
+        for (size_t v = 0; v < 60; ++v) {
+            if (pred[v] == -1)
+                continue;
+            std::span<const int> neighbors = g.getNeighbors(static_cast<size_t>(pred[v]));
+            std::span<const int> weights = g.getWeights(static_cast<size_t>(pred[v]));
+            int best = std::numeric_limits<int>::max();
+            for (size_t i = 0; i < neighbors.size(); ++i)
+                if (neighbors[i] == static_cast<int>(v))
+                    best = std::min(best, weights[i]);
+            EXPECT_EQ(dist[static_cast<size_t>(pred[v])] + best, dist[v]);
+        }
+    }
+}
+
+TEST_F(AlgorithmsTest, ParallelBellmanFord_NegativeCycleAndErrors)
+{
+    CsrGraph cycle(4, { { 0, 1, 1 }, { 1, 2, -1 }, { 2, 3, -1 }, { 3, 1, 1 } });
+    EXPECT_THROW(parallelBellmanFord(cycle, 0, 2), std::runtime_error);
+    EXPECT_THROW(parallelBellmanFord(CsrGraph(1, { { 0, 0, -1 } }), 0), std::runtime_error);
+    EXPECT_THROW(parallelBellmanFord(cycle, 4), std::out_of_range);
+
+    auto [dist, pred] = parallelBellmanFord(CsrGraph(3, { { 0, 1, 2 } }), 0, 4);
+    EXPECT_EQ(dist, (std::vector<int> { 0, 2, std::numeric_limits<int>::max() }));
+    EXPECT_EQ(pred, (std::vector<int> { -1, 0, -1 }));
+}
+
+TEST_F(AlgorithmsTest, ParallelBellmanFord_OverflowPropagatesFromWorkers)
+{
+    // The path reaches INT_MAX near the end of the chain, in the last worker's range of heads.
+    std::vector<CsrGraph::Edge> edges;
+    for (int v = 0; v + 1 < 5000; ++v)
+        edges.push_back({ v, v + 1, 500000 });
+    CsrGraph chain(5000, edges);
+    EXPECT_THROW(bellmanFord(chain, 0), std::overflow_error);
+    for (size_t threads : { 1u, 4u })
+        EXPECT_THROW(parallelBellmanFord(chain, 0, threads), std::overflow_error);
+
+    CsrGraph limit(3, { { 0, 1, std::numeric_limits<int>::max() - 1 }, { 1, 2, 1 } });
+    EXPECT_THROW(parallelBellmanFord(limit, 0, 2), std::overflow_error);
+    EXPECT_EQ(parallelBellmanFord(limit, 1, 2).first[2], 1);
+}
+
 // --- Topological Sort Tests ---
 
 TEST_F(AlgorithmsTest, TopologicalSort_DAG)
@@ -221,3 +508,394 @@ TEST_F(AlgorithmsTest, TopologicalSort_DisconnectedDAG)
     EXPECT_LT(position[0], position[1]);
     EXPECT_LT(position[2], position[3]);
 }
+
+TEST_F(AlgorithmsTest, TopologicalLevels_MatchLongestHopDepth)
+{
+    // Wide layered DAG so that most levels are expanded by several workers.
+    const size_t n = 60000;
+    std::vector<CsrGraph::Edge> edges;
+    for (size_t v = 20000; v < n; ++v)
+        for (size_t k = 1; k <= 3; ++k)
+            edges.push_back(
+                { static_cast<int>((v * 7919 + k * 104729) % v), static_cast<int>(v), 1 });
+    CsrGraph csr(n, edges);
+
+    std::vector<int> depth(n, 0);
+    for (int u : topologicalSort(csr))
+        for (int v : csr.getNeighbors(static_cast<size_t>(u)))
+            depth[static_cast<size_t>(v)]
+                = std::max(depth[static_cast<size_t>(v)], depth[static_cast<size_t>(u)] + 1);
+
+    for (size_t threads : { 1u, 4u }) {
+        std::vector<std::vector<int>> levels = topologicalLevels(csr, threads);
+        size_t total = 0;
+        for (size_t level = 0; level < levels.size(); ++level) {
+            total += levels[level].size();
+            for (int v : levels[level])
+                ASSERT_EQ(depth[static_cast<size_t>(v)], static_cast<int>(level));
+        }
+        EXPECT_EQ(total, n);
+    }
+
+    Graph cyclic(4, false);
+    cyclic.addEdge(0, 1);
+    cyclic.addEdge(1, 2);
+    cyclic.addEdge(2, 1);
+    EXPECT_THROW(topologicalLevels(cyclic, 2), std::runtime_error);
+    EXPECT_TRUE(topologicalLevels(Graph(0, false)).empty());
+}
+
+TEST_F(AlgorithmsTest, CriticalPath_MatchesSequentialLongestPath)
+{
+    const size_t n = 30000;
+    std::vector<CsrGraph::Edge> edges;
+    for (size_t v = 1; v < n; ++v)
+        for (size_t k = 1; k <= 2; ++k)
+            edges.push_back({ static_cast<int>((v * 31 + k * 17) % v), static_cast<int>(v),
+                static_cast<int>((v * k) % 13) - 2 });
+    CsrGraph g(n, edges);
+
+    std::vector<int> longest(n, 0);
+    for (int u : topologicalSort(g)) {
+        std::span<const int> heads = g.getNeighbors(static_cast<size_t>(u));
+        std::span<const int> weights = g.getWeights(static_cast<size_t>(u));
+        for (size_t i = 0; i < heads.size(); ++i) {
+            size_t v = static_cast<size_t>(heads[i]);
+            longest[v] = std::max(longest[v], longest[static_cast<size_t>(u)] + weights[i]);
+        }
+    }
+
+    CriticalPathResult result = criticalPath(g, 4);
+    EXPECT_EQ(result.lengths, longest);
+    EXPECT_EQ(result.length, *std::max_element(longest.begin(), longest.end()));
+    ASSERT_FALSE(result.path.empty());
+    EXPECT_EQ(result.predecessors[static_cast<size_t>(result.path.front())], -1);
+    for (size_t i = 1; i < result.path.size(); ++i)
+        EXPECT_EQ(result.predecessors[static_cast<size_t>(result.path[i])], result.path[i - 1]);
+    EXPECT_EQ(result.lengths[static_cast<size_t>(result.path.back())], result.length);
+
+    // Every in-edge of 1 is negative, so the vertex alone is its longest path.
+    CriticalPathResult negative = criticalPath(CsrGraph(3, { { 0, 1, -2 }, { 0, 2, 3 } }));
+    EXPECT_EQ(negative.lengths, (std::vector<int> { 0, 0, 3 }));
+    EXPECT_EQ(negative.predecessors, (std::vector<int> { -1, -1, 0 }));
+    EXPECT_EQ(negative.path, (std::vector<int> { 0, 2 }));
+    EXPECT_EQ(negative.length, 3);
+
+    Graph heavy(3, true);
+    heavy.addEdge(0, 1, std::numeric_limits<int>::max());
+    heavy.addEdge(1, 2, 1);
+    EXPECT_THROW(criticalPath(heavy), std::overflow_error);
+}
+
+// --- Distance Type Tests ---
+
+TEST_F(AlgorithmsTest, DistanceTypes_Int64HandlesPathsBeyondIntRange)
+{
+    Graph g(4, true);
+    g.addEdge(0, 1, 2000000000);
+    g.addEdge(1, 2, 2000000000);
+    g.addEdge(2, 3, 2000000000);
+
+    EXPECT_THROW(dijkstra(g, 0), std::overflow_error);
+    EXPECT_THROW(bellmanFord(g, 0), std::overflow_error);
+
+    auto [dist, pred] = dijkstra<std::int64_t>(g, 0);
+    EXPECT_EQ(dist[3], 6000000000LL);
+    EXPECT_EQ(pred[3], 2);
+    EXPECT_EQ(bellmanFord<std::int64_t>(g, 0, BellmanFordMode::Queue).first, dist);
+    EXPECT_EQ(dijkstra<std::int64_t>(g, 3).first[0], std::numeric_limits<std::int64_t>::max());
+
+    // INT_MAX marks unreachable vertices, so a path of exactly that length does not fit either.
+    Graph limit(3, true);
+    limit.addEdge(0, 1, std::numeric_limits<int>::max() - 1);
+    EXPECT_EQ(dijkstra(limit, 0).first[1], std::numeric_limits<int>::max() - 1);
+    limit.addEdge(1, 2, 1);
+    EXPECT_THROW(dijkstra(limit, 0), std::overflow_error);
+    EXPECT_THROW(bellmanFord(limit, 0), std::overflow_error);
+}
+
+TEST_F(AlgorithmsTest, DistanceTypes_AllTypesAgreeWithInt)
+{
+    std::vector<CsrGraph::Edge> edges;
+    for (int i = 0; i < 50; ++i) {
+        edges.push_back({ i, (i + 1) % 50, 5 });
+        edges.push_back({ i, (i * 7 + 3) % 50, (i % 4) - 1 + (i % 7) });
+    }
+    CsrGraph g(51, edges); // vertex 50 is unreachable
+
+    for (BellmanFordMode mode : { BellmanFordMode::FullPasses, BellmanFordMode::Queue }) {
+        std::vector<int> expected = bellmanFord(g, 0, mode).first;
+        std::vector<std::int64_t> wide = bellmanFord<std::int64_t>(g, 0, mode).first;
+        std::vector<double> real = bellmanFord<double>(g, 0, mode).first;
+        std::vector<float> narrow = bellmanFord<float>(g, 0, mode).first;
+        for (size_t v = 0; v < 50; ++v) {
+            EXPECT_EQ(wide[v], expected[v]);
+            EXPECT_EQ(real[v], expected[v]);
+            EXPECT_EQ(narrow[v], static_cast<float>(expected[v]));
+        }
+        EXPECT_EQ(wide[50], std::numeric_limits<std::int64_t>::max());
+        EXPECT_EQ(real[50], std::numeric_limits<double>::infinity());
+    }
+
+    Graph positive(30, true);
+    for (size_t i = 0; i < 30; ++i)
+        positive.addEdge(i, (i * 11 + 4) % 30, static_cast<int>(i % 6) + 1);
+    std::vector<int> expected = dijkstra(positive, 0).first;
+    BasicShortestPathWorkspace<double> workspace;
+    dijkstra(CsrGraph(positive), 0, workspace);
+    for (size_t v = 0; v < 30; ++v) {
+        double distance = workspace.getDistance(v);
+        if (expected[v] == std::numeric_limits<int>::max())
+            EXPECT_EQ(distance, std::numeric_limits<double>::infinity());
+        else
+            EXPECT_EQ(distance, expected[v]);
+    }
+}
+
+// --- k Shortest Paths Tests ---
+
+namespace {
+
+// Lengths of all s-t paths of at most maxLength, simple or not, by depth-first enumeration.
+void enumeratePaths(const Graph& g, int u, int target, int length, int maxLength, bool simple,
+    std::vector<bool>& onPath, std::vector<int>& lengths)
+{
+    if (u == target)
+        lengths.push_back(length);
+    onPath[static_cast<size_t>(u)] = true;
+    for (int v : g.getNeighbors(static_cast<size_t>(u))) {
+        int next = length + g.getEdgeWeight(static_cast<size_t>(u), static_cast<size_t>(v));
+        if (next <= maxLength && !(simple && onPath[static_cast<size_t>(v)]))
+            enumeratePaths(g, v, target, next, maxLength, simple, onPath, lengths);
+    }
+    onPath[static_cast<size_t>(u)] = false;
+}
+
+void expectValidPaths(const Graph& g, const std::vector<std::pair<std::vector<int>, int>>& paths,
+    int source, int target)
+{
+    std::set<std::vector<int>> distinct;
+    for (const auto& [path, length] : paths) {
+        ASSERT_FALSE(path.empty());
+        EXPECT_EQ(path.front(), source);
+        EXPECT_EQ(path.back(), target);
+        int total = 0;
+        for (size_t i = 1; i < path.size(); ++i)
+            total += g.getEdgeWeight(
+                static_cast<size_t>(path[i - 1]), static_cast<size_t>(path[i]));
+        EXPECT_EQ(total, length);
+        distinct.insert(path);
+    }
+    EXPECT_EQ(distinct.size(), paths.size());
+}
+
+Graph randomKPathsGraph()
+{
+    Graph g(9, true);
+    for (size_t u = 0; u < 9; ++u)
+        for (size_t v = 0; v < 9; ++v)
+            if (u != v && (u * 5 + v * 3) % 7 < 3)
+                g.addEdge(u, v, static_cast<int>((u * 7 + v) % 5) + 1);
+    return g;
+}
+
+} // namespace
+
+TEST_F(AlgorithmsTest, KShortestPaths_LooplessMatchesBruteForce)
+{
+    Graph g = randomKPathsGraph();
+    std::vector<bool> onPath(9, false);
+    std::vector<int> expected;
+    enumeratePaths(g, 0, 7, 0, std::numeric_limits<int>::max(), true, onPath, expected);
+    std::sort(expected.begin(), expected.end());
+    ASSERT_GT(expected.size(), 10u);
+
+    for (size_t threads : { 1, 3 }) {
+        auto paths = kShortestPaths(g, 0, 7, 10, KShortestPathsMode::Loopless, threads);
+        ASSERT_EQ(paths.size(), 10u);
+        expectValidPaths(g, paths, 0, 7);
+        for (size_t i = 0; i < paths.size(); ++i) {
+            EXPECT_EQ(paths[i].second, expected[i]);
+            std::set<int> vertices(paths[i].first.begin(), paths[i].first.end());
+            EXPECT_EQ(vertices.size(), paths[i].first.size());
+        }
+    }
+
+    // Asking for more paths than exist returns all of them.
+    EXPECT_EQ(kShortestPaths(g, 0, 7, 100000).size(), expected.size());
+}
+
+TEST_F(AlgorithmsTest, KShortestPaths_WalksMatchBruteForce)
+{
+    Graph g = randomKPathsGraph();
+    auto paths = kShortestPaths(g, 0, 7, 25, KShortestPathsMode::Walks);
+    ASSERT_EQ(paths.size(), 25u);
+    expectValidPaths(g, paths, 0, 7);
+
+    std::vector<bool> onPath(9, false);
+    std::vector<int> expected;
+    enumeratePaths(g, 0, 7, 0, paths.back().second, false, onPath, expected);
+    std::sort(expected.begin(), expected.end());
+    for (size_t i = 0; i < paths.size(); ++i)
+        EXPECT_EQ(paths[i].second, expected[i]);
+}
+
+TEST_F(AlgorithmsTest, KShortestPaths_EdgeCases)
+{
+    Graph g(4, true);
+    g.addEdge(0, 1, 1);
+    g.addEdge(1, 0, 1);
+
+    EXPECT_TRUE(kShortestPaths(g, 0, 3, 5).empty());
+    EXPECT_TRUE(kShortestPaths(g, 0, 1, 0).empty());
+
+    auto self = kShortestPaths(g, 0, 0, 5);
+    ASSERT_EQ(self.size(), 1u);
+    EXPECT_EQ(self[0].first, std::vector<int>({ 0 }));
+    EXPECT_EQ(self[0].second, 0);
+
+    // The 0 -> 1 -> 0 cycle gives infinitely many walks.
+    auto walks = kShortestPaths(g, 0, 0, 3, KShortestPathsMode::Walks);
+    ASSERT_EQ(walks.size(), 3u);
+    EXPECT_EQ(walks[2].first, std::vector<int>({ 0, 1, 0, 1, 0 }));
+
+    EXPECT_THROW(kShortestPaths(g, 4, 0, 1), std::out_of_range);
+    CsrGraph negative(2, { { 0, 1, -1 } });
+    EXPECT_THROW(kShortestPaths(negative, 0, 1, 1), std::invalid_argument);
+}
+
+// --- Johnson Tests ---
+
+TEST_F(AlgorithmsTest, Johnson_MatchesBellmanFordWithNegativeEdges)
+{
+    std::vector<CsrGraph::Edge> edges;
+    for (int i = 0; i < 60; ++i) {
+        edges.push_back({ i, (i + 1) % 60, 5 });
+        edges.push_back({ i, (i * 7 + 3) % 60, (i % 4) - 1 + (i % 7) });
+    }
+    edges.push_back({ 3, 3, 1 });
+    CsrGraph g(61, edges); // vertex 60 is isolated
+
+    for (size_t threads : { 1, 4 }) {
+        DistanceMatrix matrix = johnson(g, MatrixLayout::RowMajor, DistanceWidth::Int32, threads);
+        ASSERT_EQ(matrix.getNumVertices(), 61u);
+        for (size_t s = 0; s < 61; ++s)
+            EXPECT_EQ(matrix.getRow(s), bellmanFord(g, s).first);
+    }
+}
+
+TEST_F(AlgorithmsTest, Johnson_CompactFormatsMatchDijkstra)
+{
+    Graph g(90, true);
+    for (size_t i = 0; i < 90; ++i) {
+        g.addEdge(i, (i + 1) % 90, 3);
+        g.addEdge(i, (i * 17 + 2) % 90, static_cast<int>(i % 9) + 1);
+    }
+
+    DistanceMatrix blocked = johnson(g, MatrixLayout::Blocked, DistanceWidth::Int16, 3);
+    EXPECT_EQ(blocked.getLayout(), MatrixLayout::Blocked);
+    EXPECT_EQ(blocked.getWidth(), DistanceWidth::Int16);
+    for (size_t s = 0; s < 90; ++s)
+        EXPECT_EQ(blocked.getRow(s), dijkstra(g, s).first);
+}
+
+TEST_F(AlgorithmsTest, Johnson_NegativeCycleAndOverflow)
+{
+    CsrGraph cycle(3, { { 0, 1, 2 }, { 1, 2, -4 }, { 2, 1, 1 } });
+    EXPECT_THROW(johnson(cycle), std::runtime_error);
+
+    Graph g(2, true);
+    g.addEdge(0, 1, 40000);
+    EXPECT_THROW(johnson(g, MatrixLayout::RowMajor, DistanceWidth::Int16), std::overflow_error);
+    EXPECT_EQ(johnson(g).get(0, 1), 40000);
+    EXPECT_EQ(johnson(g).get(1, 0), std::numeric_limits<int>::max());
+}
+
+TEST_F(AlgorithmsTest, Johnson_NearIntMaxPathsThroughNegativeEdges)
+{
+    const int max = std::numeric_limits<int>::max();
+    DistanceMatrix fits = johnson(CsrGraph(3, { { 0, 1, -5 }, { 1, 2, max - 1 } }));
+    EXPECT_EQ(fits.get(0, 2), max - 6);
+    EXPECT_EQ(fits.get(1, 2), max - 1);
+
+    // The reweighted edge 0 -> 1 exceeds INT_MAX even though every true distance fits.
+    EXPECT_THROW(johnson(CsrGraph(3, { { 0, 1, max - 1 }, { 2, 1, -5 } })), std::overflow_error);
+    // The true distance 0 -> 2 is INT_MAX + 3, though the reweighted one fits.
+    EXPECT_THROW(johnson(CsrGraph(4, { { 3, 0, -5 }, { 0, 1, max - 2 }, { 1, 2, 5 } })),
+        std::overflow_error);
+}
+
+// --- Floyd-Warshall Tests ---
+
+TEST_F(AlgorithmsTest, FloydWarshall_MatchesDijkstraAcrossTiles)
+{
+    // 150 vertices span three tiles, the last one padded.
+    Graph g(150, true);
+    for (size_t u = 0; u < 150; ++u)
+        for (size_t v = 0; v < 150; ++v)
+            if (u != v && (u * 31 + v * 17) % 5 == 0)
+                g.addEdge(u, v, static_cast<int>((u * 13 + v * 7) % 50) + 1);
+    g.addEdge(3, 3, 4);
+
+    for (size_t threads : { 1, 4 }) {
+        std::vector<int> pred;
+        DistanceMatrix matrix = floydWarshall(g, &pred, threads);
+        ASSERT_EQ(pred.size(), 150u * 150u);
+
+        for (size_t s = 0; s < 150; ++s) {
+            std::vector<int> expected = dijkstra(g, s).first;
+            ASSERT_EQ(matrix.getRow(s), expected);
+
+            for (size_t v = 0; v < 150; ++v) {
+                int p = pred[s * 150 + v];
+                if (v == s || expected[v] == std::numeric_limits<int>::max()) {
+                    EXPECT_EQ(p, -1);
+                    continue;
+                }
+                ASSERT_NE(p, -1);
+                size_t before = static_cast<size_t>(p);
+                EXPECT_EQ(expected[before] + g.getEdgeWeight(before, v), expected[v]);
+            }
+        }
+    }
+}
+
+TEST_F(AlgorithmsTest, FloydWarshall_UnreachableAndEmpty)
+{
+    Graph g(3, true);
+    g.addEdge(0, 1, 2);
+    g.addEdge(1, 2, 3);
+
+    DistanceMatrix matrix = floydWarshall(g);
+    EXPECT_EQ(matrix.getRow(0), std::vector<int>({ 0, 2, 5 }));
+    EXPECT_EQ(matrix.get(2, 0), std::numeric_limits<int>::max());
+    EXPECT_EQ(matrix.getLayout(), MatrixLayout::Blocked);
+
+    EXPECT_EQ(floydWarshall(Graph()).getNumVertices(), 0u);
+}
+
+TEST_F(AlgorithmsTest, FloydWarshall_LargeWeightsThrowInsteadOfWrapping)
+{
+    // The finite limit is 2^30 - 1, so one edge above it is rejected outright.
+    Graph heavy(2, true);
+    heavy.addEdge(0, 1, 1500000000);
+    EXPECT_THROW(floydWarshall(heavy), std::overflow_error);
+
+    // Each edge fits, but the path 0 -> 1 -> 2 does not; it must not read as unreachable.
+    Graph far(3, true);
+    far.addEdge(0, 1, 600000000);
+    far.addEdge(1, 2, 600000000);
+    EXPECT_THROW(floydWarshall(far), std::overflow_error);
+    EXPECT_THROW(floydWarshall(far, nullptr, 4), std::overflow_error);
+
+    // A long detour is harmless when a shorter path replaces it.
+    far.addEdge(0, 2, 5);
+    DistanceMatrix matrix = floydWarshall(far);
+    EXPECT_EQ(matrix.getRow(0), std::vector<int>({ 0, 600000000, 5 }));
+    EXPECT_EQ(matrix.get(2, 0), std::numeric_limits<int>::max());
+
+    // Exactly one below the limit still works, across tiles.
+    Graph edge(130, true);
+    edge.addEdge(0, 129, (1 << 30) - 2);
+    EXPECT_EQ(floydWarshall(edge).get(0, 129), (1 << 30) - 2);
+}
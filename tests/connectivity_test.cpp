@@ -0,0 +1,179 @@
+#include "../include/Connectivity.h"
+#include <gtest/gtest.h>
+#include <random>
+#include <set>
+
+class ConnectivityTest : public ::testing::Test {
+protected:
+    // Helper method to label weakly connected components with a sequential search, smallest
+    // vertex first
+    std::vector<int> referenceLabels(const CsrGraph& g)
+    {
+        size_t n = g.getNumVertices();
+        std::vector<std::vector<int>> undirected(n);
+        for (const CsrGraph::Edge& edge : g.getEdges()) {
+            undirected[static_cast<size_t>(edge.from)].push_back(edge.to);
+            undirected[static_cast<size_t>(edge.to)].push_back(edge.from);
+        }
+
+        std::vector<int> labels(n, -1);
+        for (size_t root = 0; root < n; ++root) {
+            if (labels[root] >= 0)
+                continue;
+            std::vector<int> stack { static_cast<int>(root) };
+            labels[root] = static_cast<int>(root);
+            while (!stack.empty()) {
+                int u = stack.back();
+                stack.pop_back();
+                for (int v : undirected[static_cast<size_t>(u)])
+                    if (labels[static_cast<size_t>(v)] < 0) {
+                        labels[static_cast<size_t>(v)] = static_cast<int>(root);
+                        stack.push_back(v);
+                    }
+            }
+        }
+        return labels;
+    }
+
+    // Helper method to create a giant component plus small directed clusters and isolated vertices
+    CsrGraph createClusteredGraph(size_t numVertices, unsigned seed)
+    {
+        std::mt19937 gen(seed);
+        size_t giant = numVertices * 3 / 4;
+        std::uniform_int_distribution<int> giantDist(0, static_cast<int>(giant) - 1);
+        std::vector<CsrGraph::Edge> edges;
+        for (size_t i = 0; i < 3 * giant; ++i)
+            edges.push_back({ giantDist(gen), giantDist(gen), 1 });
+        for (size_t v = giant; v + 3 < numVertices; v += 5) {
+            int base = static_cast<int>(v);
+            edges.push_back({ base + 1, base, 1 });
+            edges.push_back({ base + 2, base + 1, 1 });
+            edges.push_back({ base + 2, base + 3, 1 });
+        }
+        return CsrGraph(numVertices, edges);
+    }
+};
+
+TEST_F(ConnectivityTest, MatchesSequentialSearch)
+{
+    for (unsigned seed : { 1u, 2u, 3u }) {
+        CsrGraph g = createClusteredGraph(20000, seed);
+        std::vector<int> expected = referenceLabels(g);
+        for (size_t threads : { 1, 2, 4 })
+            EXPECT_EQ(connectedComponents(g, threads), expected);
+    }
+
+    // The giant component is only reachable through in-edges of its members.
+    CsrGraph star(6, { { 1, 0, 1 }, { 2, 0, 1 }, { 3, 0, 1 }, { 4, 0, 1 }, { 5, 4, 1 } });
+    EXPECT_EQ(connectedComponents(star), (std::vector<int>(6, 0)));
+    EXPECT_TRUE(connectedComponents(CsrGraph()).empty());
+}
+
+TEST_F(ConnectivityTest, GraphOverloadAndIsConnected)
+{
+    Graph g(5);
+    g.addEdge(3, 1, 1);
+    g.addEdge(1, 0, 1);
+    g.addEdge(4, 2, 1);
+    EXPECT_EQ(connectedComponents(g), (std::vector<int> { 0, 0, 2, 0, 2 }));
+    EXPECT_FALSE(g.isConnected());
+
+    // Only vertex 3 reaches every other vertex, and it is neither first nor last.
+    g.addEdge(3, 4, 1);
+    EXPECT_EQ(connectedComponents(g), (std::vector<int>(5, 0)));
+    EXPECT_TRUE(g.isConnected());
+
+    g.removeEdge(3, 4);
+    g.addEdge(0, 3, 1);
+    EXPECT_FALSE(g.isConnected());
+}
+
+TEST_F(ConnectivityTest, BiconnectedComponentsMatchBruteForce)
+{
+    // Two triangles sharing vertex 2, a pendant path 4 - 5 - 6 and an isolated vertex 7; edges
+    // are stored in one or both directions.
+    CsrGraph small(8,
+        { { 0, 1, 1 }, { 1, 2, 1 }, { 2, 0, 1 }, { 0, 2, 1 }, { 2, 3, 1 }, { 3, 4, 1 },
+            { 4, 2, 1 }, { 5, 4, 1 }, { 5, 6, 1 }, { 6, 6, 1 } });
+    BiconnectedResult expected {
+        { { 0, 1, 2 }, { 2, 3, 4 }, { 4, 5 }, { 5, 6 } }, { 2, 4, 5 }, { { 4, 5 }, { 5, 6 } }
+    };
+    BiconnectedResult result = biconnectedComponents(small);
+    EXPECT_EQ(result.components, expected.components);
+    EXPECT_EQ(result.articulationPoints, expected.articulationPoints);
+    EXPECT_EQ(result.bridges, expected.bridges);
+
+    for (unsigned seed : { 4u, 5u, 6u, 7u }) {
+        Graph g(40);
+        std::mt19937 gen(seed);
+        std::uniform_int_distribution<size_t> vertexDist(0, 39);
+        for (int i = 0; i < 48; ++i)
+            g.addEdge(vertexDist(gen), vertexDist(gen));
+
+        CsrGraph csr(g);
+        auto countComponents = [](const CsrGraph& graph) {
+            std::vector<int> labels = connectedComponents(graph, 1);
+            size_t count = 0;
+            for (size_t v = 0; v < labels.size(); ++v)
+                count += labels[v] == static_cast<int>(v);
+            return count;
+        };
+        size_t baseline = countComponents(csr);
+
+        // A vertex is an articulation point iff deleting it (leaving it isolated) adds two or
+        // more components; an edge is a bridge iff deleting both of its directions adds one.
+        std::vector<int> articulation;
+        std::vector<std::pair<int, int>> bridges;
+        std::vector<CsrGraph::Edge> edges = csr.getEdges();
+        for (int v = 0; v < 40; ++v) {
+            std::vector<CsrGraph::Edge> kept;
+            for (const CsrGraph::Edge& edge : edges)
+                if (edge.from != v && edge.to != v)
+                    kept.push_back(edge);
+            if (countComponents(CsrGraph(40, kept)) > baseline + 1)
+                articulation.push_back(v);
+        }
+        std::set<std::pair<int, int>> pairs;
+        for (const CsrGraph::Edge& edge : edges)
+            if (edge.from != edge.to)
+                pairs.insert({ std::min(edge.from, edge.to), std::max(edge.from, edge.to) });
+        for (auto [a, b] : pairs) {
+            std::vector<CsrGraph::Edge> kept;
+            for (const CsrGraph::Edge& edge : edges)
+                if (std::min(edge.from, edge.to) != a || std::max(edge.from, edge.to) != b)
+                    kept.push_back(edge);
+            if (countComponents(CsrGraph(40, kept)) > baseline)
+                bridges.emplace_back(a, b);
+        }
+
+        BiconnectedResult sequential = biconnectedComponents(g);
+        EXPECT_EQ(sequential.articulationPoints, articulation);
+        EXPECT_EQ(sequential.bridges, bridges);
+        for (size_t threads : { 1, 3 }) {
+            BiconnectedResult parallel = parallelBiconnectedComponents(csr, threads);
+            EXPECT_EQ(parallel.components, sequential.components);
+            EXPECT_EQ(parallel.articulationPoints, sequential.articulationPoints);
+            EXPECT_EQ(parallel.bridges, sequential.bridges);
+        }
+    }
+}
+
+TEST_F(ConnectivityTest, BiconnectedComponentsOnDeepAndLargeGraphs)
+{
+    // A path this long would overflow a recursive depth-first search.
+    const int length = 1000000;
+    std::vector<CsrGraph::Edge> path;
+    for (int v = 0; v + 1 < length; ++v)
+        path.push_back({ v, v + 1, 1 });
+    BiconnectedResult result = biconnectedComponents(CsrGraph(length, path));
+    EXPECT_EQ(result.bridges.size(), static_cast<size_t>(length - 1));
+    EXPECT_EQ(result.articulationPoints.size(), static_cast<size_t>(length - 2));
+
+    CsrGraph g = createClusteredGraph(20000, 8);
+    BiconnectedResult sequential = biconnectedComponents(g);
+    BiconnectedResult parallel = parallelBiconnectedComponents(g, 4);
+    EXPECT_EQ(parallel.components, sequential.components);
+    EXPECT_EQ(parallel.articulationPoints, sequential.articulationPoints);
+    EXPECT_EQ(parallel.bridges, sequential.bridges);
+    EXPECT_TRUE(parallelBiconnectedComponents(CsrGraph()).components.empty());
+}
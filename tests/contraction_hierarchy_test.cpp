@@ -0,0 +1,177 @@
+#include "../include/Algorithms.h"
+#include "../include/ContractionHierarchy.h"
+#include <cstdint>
+#include <cstring>
+#include <gtest/gtest.h>
+#include <limits>
+#include <random>
+#include <sstream>
+
+class ContractionHierarchyTest : public ::testing::Test {
+protected:
+    // Helper method to create a grid-shaped road network with some one-way streets
+    Graph createRoadNetwork(size_t side, unsigned seed)
+    {
+        Graph g(side * side, true);
+        std::mt19937 gen(seed);
+        std::uniform_int_distribution<> weightDist(1, 20);
+        std::uniform_real_distribution<> oneWayDist(0.0, 1.0);
+
+        auto connect = [&](size_t a, size_t b) {
+            if (oneWayDist(gen) < 0.2)
+                g.addEdge(a, b, weightDist(gen));
+            else
+                g.addUndirectedEdge(a, b, weightDist(gen));
+        };
+
+        for (size_t r = 0; r < side; ++r) {
+            for (size_t c = 0; c < side; ++c) {
+                size_t v = r * side + c;
+                if (c + 1 < side)
+                    connect(v, v + 1);
+                if (r + 1 < side)
+                    connect(v, v + side);
+            }
+        }
+        return g;
+    }
+
+    void expectMatchesDijkstra(const Graph& g, const ContractionHierarchy& ch)
+    {
+        for (size_t s = 0; s < g.getNumVertices(); ++s) {
+            std::vector<int> expected = dijkstra(g, s).first;
+            for (size_t t = 0; t < g.getNumVertices(); ++t)
+                EXPECT_EQ(ch.distance(s, t), expected[t]) << s << " -> " << t;
+        }
+    }
+};
+
+TEST_F(ContractionHierarchyTest, DistancesMatchDijkstra)
+{
+    Graph g = createRoadNetwork(7, 1);
+    ContractionHierarchy ch(g, 1);
+
+    EXPECT_EQ(ch.getNumVertices(), g.getNumVertices());
+    expectMatchesDijkstra(g, ch);
+}
+
+TEST_F(ContractionHierarchyTest, ParallelPreprocessingMatchesDijkstra)
+{
+    Graph g = createRoadNetwork(8, 2);
+    ContractionHierarchy ch(g, 4);
+
+    expectMatchesDijkstra(g, ch);
+}
+
+TEST_F(ContractionHierarchyTest, UnpackedPathsAreShortest)
+{
+    Graph g = createRoadNetwork(6, 3);
+    ContractionHierarchy ch(g);
+
+    for (size_t s = 0; s < g.getNumVertices(); s += 5) {
+        for (size_t t = 0; t < g.getNumVertices(); ++t) {
+            std::vector<int> path = ch.shortestPath(s, t);
+            int distance = ch.distance(s, t);
+            if (distance == std::numeric_limits<int>::max()) {
+                EXPECT_TRUE(path.empty());
+                continue;
+            }
+
+            ASSERT_FALSE(path.empty());
+            EXPECT_EQ(path.front(), static_cast<int>(s));
+            EXPECT_EQ(path.back(), static_cast<int>(t));
+
+            int length = 0;
+            for (size_t i = 0; i + 1 < path.size(); ++i)
+                length += g.getEdgeWeight(
+                    static_cast<size_t>(path[i]), static_cast<size_t>(path[i + 1]));
+            EXPECT_EQ(length, distance);
+        }
+    }
+}
+
+TEST_F(ContractionHierarchyTest, UnreachableTarget)
+{
+    Graph g(4, true);
+    g.addEdge(0, 1, 3);
+    g.addEdge(1, 2, 4);
+    g.addEdge(3, 0, 1);
+
+    ContractionHierarchy ch(g);
+
+    EXPECT_EQ(ch.distance(0, 2), 7);
+    EXPECT_EQ(ch.distance(3, 2), 8);
+    EXPECT_EQ(ch.distance(2, 0), std::numeric_limits<int>::max());
+    EXPECT_TRUE(ch.shortestPath(0, 3).empty());
+    EXPECT_EQ(ch.shortestPath(1, 1), std::vector<int> { 1 });
+}
+
+TEST_F(ContractionHierarchyTest, SaveLoadRoundTrip)
+{
+    Graph g = createRoadNetwork(5, 4);
+    ContractionHierarchy ch(g);
+
+    std::stringstream buffer;
+    ch.save(buffer);
+    ContractionHierarchy loaded = ContractionHierarchy::load(buffer);
+
+    EXPECT_EQ(loaded.getNumShortcuts(), ch.getNumShortcuts());
+    for (size_t v = 0; v < g.getNumVertices(); ++v)
+        EXPECT_EQ(loaded.getRank(v), ch.getRank(v));
+    expectMatchesDijkstra(g, loaded);
+    EXPECT_EQ(loaded.shortestPath(0, 24), ch.shortestPath(0, 24));
+}
+
+TEST_F(ContractionHierarchyTest, ErrorHandling)
+{
+    Graph g(2, true);
+    g.addEdge(0, 1, 1);
+    ContractionHierarchy ch(g);
+
+    EXPECT_THROW(ch.distance(0, 2), std::out_of_range);
+    EXPECT_THROW(ch.shortestPath(2, 0), std::out_of_range);
+    EXPECT_THROW(ch.getRank(2), std::out_of_range);
+
+    std::stringstream garbage("definitely not a hierarchy");
+    EXPECT_THROW(ContractionHierarchy::load(garbage), std::runtime_error);
+
+    // Corrupt counts must fail on the stream contents, not in a huge allocation.
+    std::stringstream saved;
+    ch.save(saved);
+    const std::string bytes = saved.str();
+    auto loadWithCount = [&](size_t offset, std::uint64_t count) {
+        std::string corrupt = bytes;
+        std::memcpy(corrupt.data() + offset, &count, sizeof(count));
+        std::stringstream stream(corrupt);
+        return ContractionHierarchy::load(stream);
+    };
+    EXPECT_THROW(loadWithCount(8, std::numeric_limits<int>::max()), std::runtime_error);
+    EXPECT_THROW(loadWithCount(8, std::uint64_t { 1 } << 40), std::runtime_error);
+    EXPECT_THROW(loadWithCount(16, std::uint64_t { 1 } << 40), std::runtime_error);
+    std::stringstream cut(bytes.substr(0, bytes.size() - 1));
+    EXPECT_THROW(ContractionHierarchy::load(cut), std::runtime_error);
+}
+
+TEST_F(ContractionHierarchyTest, LargeWeights)
+{
+    const int half = std::numeric_limits<int>::max() / 2;
+
+    // Heavy edges whose sums still fit match Dijkstra, including long detours the witness
+    // search must not wrap around on.
+    Graph fits(4, true);
+    fits.addEdge(0, 1, half);
+    fits.addEdge(1, 2, half);
+    fits.addEdge(0, 3, half);
+    fits.addEdge(3, 2, 1);
+    ContractionHierarchy ch(fits);
+    expectMatchesDijkstra(fits, ch);
+    EXPECT_EQ(ch.distance(0, 2), half + 1);
+
+    // The only route from 0 to 2 is longer than INT_MAX. Depending on the contraction order it
+    // fails as a shortcut or during the query, but it never wraps around.
+    Graph chain(3, true);
+    chain.addEdge(0, 1, half + 1);
+    chain.addEdge(1, 2, half + 1);
+    EXPECT_THROW(dijkstra(chain, 0), std::overflow_error);
+    EXPECT_THROW(ContractionHierarchy(chain).distance(0, 2), std::overflow_error);
+}
@@ -0,0 +1,58 @@
+#include "../include/CsrGraph.h"
+#include <gtest/gtest.h>
+
+class CsrGraphTest : public ::testing::Test { };
+
+TEST_F(CsrGraphTest, SnapshotMatchesGraph)
+{
+    Graph g(4, true);
+    g.addEdge(0, 1, 5);
+    g.addEdge(0, 3, 2);
+    g.addEdge(2, 0, 7);
+    g.addEdge(3, 2, 1);
+
+    CsrGraph csr(g);
+
+    EXPECT_EQ(csr.getNumVertices(), 4u);
+    EXPECT_EQ(csr.getNumEdges(), 4u);
+    for (size_t u = 0; u < g.getNumVertices(); ++u) {
+        std::vector<int> expected = g.getNeighbors(u);
+        std::span<const int> neighbors = csr.getNeighbors(u);
+        std::span<const int> weights = csr.getWeights(u);
+        ASSERT_EQ(neighbors.size(), expected.size());
+        EXPECT_EQ(csr.edgeEnd(u) - csr.edgeBegin(u), expected.size());
+        for (size_t i = 0; i < expected.size(); ++i) {
+            EXPECT_EQ(neighbors[i], expected[i]);
+            EXPECT_EQ(weights[i], g.getEdgeWeight(u, static_cast<size_t>(expected[i])));
+        }
+    }
+}
+
+TEST_F(CsrGraphTest, EdgeListKeepsOrderAndTransposes)
+{
+    CsrGraph csr(3, { { 1, 2, 4 }, { 0, 2, 3 }, { 1, 0, 9 } });
+
+    ASSERT_EQ(csr.getNeighbors(1).size(), 2u);
+    EXPECT_EQ(csr.getNeighbors(1)[0], 2);
+    EXPECT_EQ(csr.getNeighbors(1)[1], 0);
+    EXPECT_EQ(csr.getWeights(1)[1], 9);
+    EXPECT_TRUE(csr.getNeighbors(2).empty());
+    EXPECT_FALSE(csr.hasNegativeWeights());
+    EXPECT_TRUE(CsrGraph(2, { { 0, 1, -3 } }).hasNegativeWeights());
+
+    CsrGraph reversed = csr.transpose();
+    EXPECT_EQ(reversed.getNumEdges(), 3u);
+    ASSERT_EQ(reversed.getNeighbors(2).size(), 2u);
+    EXPECT_EQ(reversed.getNeighbors(0)[0], 1);
+    EXPECT_EQ(reversed.getWeights(0)[0], 9);
+}
+
+TEST_F(CsrGraphTest, ErrorHandling)
+{
+    CsrGraph empty;
+    EXPECT_EQ(empty.getNumVertices(), 0u);
+    EXPECT_THROW(empty.getNeighbors(0), std::out_of_range);
+
+    EXPECT_THROW(CsrGraph(2, { { 0, 2, 1 } }), std::out_of_range);
+    EXPECT_THROW(CsrGraph(2, { { -1, 0, 1 } }), std::out_of_range);
+}
@@ -0,0 +1,58 @@
+#include "../include/DistanceMatrix.h"
+#include <gtest/gtest.h>
+#include <limits>
+
+class DistanceMatrixTest : public ::testing::Test { };
+
+TEST_F(DistanceMatrixTest, LayoutsAndWidthsStoreTheSameEntries)
+{
+    const int INF = std::numeric_limits<int>::max();
+
+    for (MatrixLayout layout : { MatrixLayout::RowMajor, MatrixLayout::Blocked }) {
+        for (DistanceWidth width : { DistanceWidth::Int32, DistanceWidth::Int16 }) {
+            DistanceMatrix matrix(70, layout, width);
+            EXPECT_EQ(matrix.get(69, 0), INF);
+
+            for (size_t u = 0; u < 70; ++u)
+                for (size_t v = 0; v < 70; ++v)
+                    if ((u + v) % 3 != 0)
+                        matrix.set(u, v, static_cast<int>(u * 100 + v) - 3000);
+
+            for (size_t u = 0; u < 70; ++u) {
+                std::vector<int> row = matrix.getRow(u);
+                for (size_t v = 0; v < 70; ++v) {
+                    int expected = (u + v) % 3 != 0 ? static_cast<int>(u * 100 + v) - 3000 : INF;
+                    EXPECT_EQ(matrix.get(u, v), expected);
+                    EXPECT_EQ(row[v], expected);
+                }
+            }
+        }
+    }
+}
+
+TEST_F(DistanceMatrixTest, MemoryUsageReflectsFormat)
+{
+    EXPECT_EQ(DistanceMatrix(100).getMemoryUsage(), 100u * 100u * 4u);
+    EXPECT_EQ(DistanceMatrix(100, MatrixLayout::RowMajor, DistanceWidth::Int16).getMemoryUsage(),
+        100u * 100u * 2u);
+    // Two tiles per dimension once padded to the block size.
+    EXPECT_EQ(DistanceMatrix(100, MatrixLayout::Blocked).getMemoryUsage(),
+        4u * DistanceMatrix::BLOCK_SIZE * DistanceMatrix::BLOCK_SIZE * 4u);
+    EXPECT_EQ(DistanceMatrix().getMemoryUsage(), 0u);
+}
+
+TEST_F(DistanceMatrixTest, RejectsOutOfRangeAndOverflow)
+{
+    DistanceMatrix matrix(3, MatrixLayout::RowMajor, DistanceWidth::Int16);
+
+    EXPECT_THROW(matrix.get(3, 0), std::out_of_range);
+    EXPECT_THROW(matrix.set(0, 3, 1), std::out_of_range);
+    EXPECT_THROW(matrix.getRow(5), std::out_of_range);
+    EXPECT_THROW(matrix.set(0, 1, 32767), std::overflow_error);
+    EXPECT_THROW(matrix.set(0, 1, -32769), std::overflow_error);
+
+    matrix.set(0, 1, 32766);
+    matrix.set(0, 2, -32768);
+    EXPECT_EQ(matrix.get(0, 1), 32766);
+    EXPECT_EQ(matrix.get(0, 2), -32768);
+}
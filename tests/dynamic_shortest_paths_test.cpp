@@ -0,0 +1,114 @@
+#include "../include/Algorithms.h"
+#include "../include/DynamicShortestPaths.h"
+#include <gtest/gtest.h>
+#include <limits>
+#include <random>
+
+class DynamicShortestPathsTest : public ::testing::Test { };
+
+namespace {
+
+/**
+ * Checks the maintained tree against a from-scratch Dijkstra on the mirrored graph.
+ */
+void expectMatchesDijkstra(const DynamicShortestPaths& paths, const Graph& graph)
+{
+    auto [dist, pred] = dijkstra(graph, paths.getSource());
+    ASSERT_EQ(paths.distances(), dist);
+
+    const int INF = std::numeric_limits<int>::max();
+    for (size_t v = 0; v < graph.getNumVertices(); ++v) {
+        int parent = paths.getPredecessor(v);
+        if (v == paths.getSource() || dist[v] == INF) {
+            EXPECT_EQ(parent, -1);
+            continue;
+        }
+        ASSERT_GE(parent, 0);
+        EXPECT_EQ(dist[static_cast<size_t>(parent)]
+                + graph.getEdgeWeight(static_cast<size_t>(parent), v),
+            dist[v]);
+    }
+}
+
+} // namespace
+
+TEST_F(DynamicShortestPathsTest, RepairsTreeAfterEachUpdate)
+{
+    Graph graph(5);
+    graph.addEdge(0, 1, 2);
+    graph.addEdge(1, 2, 2);
+    graph.addEdge(2, 3, 2);
+    graph.addEdge(0, 3, 10);
+    DynamicShortestPaths paths(graph, 0);
+    EXPECT_EQ(paths.getDistance(3), 6);
+    EXPECT_EQ(paths.getDistance(4), std::numeric_limits<int>::max());
+
+    // A shortcut improves 2 and 3 only.
+    paths.addEdge(0, 2, 1);
+    EXPECT_EQ(paths.getDistance(3), 3);
+    EXPECT_EQ(paths.getPredecessor(2), 0);
+    EXPECT_EQ(paths.getLastRepairSize(), 2u);
+
+    // Heavier non-tree edges change nothing.
+    paths.addEdge(1, 2, 5);
+    EXPECT_EQ(paths.getLastRepairSize(), 0u);
+
+    // Cutting the tree edge into 2 falls back to the remaining paths.
+    paths.removeEdge(0, 2);
+    EXPECT_EQ(paths.getDistance(2), 7);
+    EXPECT_EQ(paths.getDistance(3), 9);
+    EXPECT_EQ(paths.getLastRepairSize(), 2u);
+
+    paths.removeEdge(0, 3);
+    paths.removeEdge(1, 2);
+    EXPECT_EQ(paths.getDistance(2), std::numeric_limits<int>::max());
+    EXPECT_EQ(paths.getPredecessor(3), -1);
+
+    paths.addEdge(1, 4, 1);
+    paths.addEdge(4, 3, 1);
+    EXPECT_EQ(paths.getDistance(3), 4);
+
+    EXPECT_THROW(paths.addEdge(0, 5, 1), std::out_of_range);
+    EXPECT_THROW(paths.addEdge(0, 1, -1), std::invalid_argument);
+    EXPECT_THROW(paths.removeEdge(5, 0), std::out_of_range);
+    EXPECT_THROW(paths.getDistance(5), std::out_of_range);
+    EXPECT_THROW(DynamicShortestPaths(graph, 5), std::out_of_range);
+    EXPECT_THROW(DynamicShortestPaths(CsrGraph(2, { { 0, 1, -1 } }), 0), std::invalid_argument);
+
+    // Same overflow rule as dijkstra: INT_MAX is reserved for unreachable vertices.
+    const int max = std::numeric_limits<int>::max();
+    EXPECT_THROW(DynamicShortestPaths(CsrGraph(3, { { 0, 1, max - 1 }, { 1, 2, 1 } }), 0),
+        std::overflow_error);
+}
+
+TEST_F(DynamicShortestPathsTest, RandomUpdatesMatchRecomputation)
+{
+    const size_t n = 60;
+    std::mt19937 rng(17);
+    std::uniform_int_distribution<size_t> vertex(0, n - 1);
+    std::uniform_int_distribution<int> weight(1, 20);
+
+    Graph graph(n);
+    for (size_t i = 0; i < 3 * n; ++i) {
+        size_t from = vertex(rng), to = vertex(rng);
+        if (from != to)
+            graph.addEdge(from, to, weight(rng));
+    }
+    DynamicShortestPaths paths(graph, 0);
+    expectMatchesDijkstra(paths, graph);
+
+    for (int step = 0; step < 400; ++step) {
+        size_t from = vertex(rng), to = vertex(rng);
+        if (from == to)
+            continue;
+        if (rng() % 3 == 0) {
+            graph.removeEdge(from, to);
+            paths.removeEdge(from, to);
+        } else {
+            int w = weight(rng);
+            graph.addEdge(from, to, w);
+            paths.addEdge(from, to, w);
+        }
+        expectMatchesDijkstra(paths, graph);
+    }
+}
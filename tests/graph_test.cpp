@@ -1,8 +1,10 @@
 #include "../include/Graph.h"
 #include <chrono>
+#include <cstdint>
 #include <gtest/gtest.h>
 #include <iomanip>
 #include <random>
+#include <ranges>
 
 // The fixture for testing the Graph Class.
 class GraphTest : public ::testing::Test {
@@ -543,6 +545,292 @@ TEST_F(GraphTest, AlgorithmPerformanceComparison)
     }
 }
 
+// ============================================================
+// Visitor Traversals
+// ============================================================
+namespace {
+
+/**
+ * Logs every event as a string and stops or prunes at configured vertices.
+ */
+class LoggingVisitor : public TraversalVisitor {
+public:
+    std::vector<std::string> events;
+    size_t stopAt = SIZE_MAX;
+    size_t pruneAt = SIZE_MAX;
+
+    TraversalControl discoverVertex(size_t vertex) override
+    {
+        events.push_back("d" + std::to_string(vertex));
+        if (vertex == stopAt)
+            return TraversalControl::Stop;
+        return vertex == pruneAt ? TraversalControl::Prune : TraversalControl::Continue;
+    }
+
+    TraversalControl examineEdge(size_t from, size_t to) override
+    {
+        events.push_back("e" + std::to_string(from) + std::to_string(to));
+        return TraversalControl::Continue;
+    }
+
+    TraversalControl finishVertex(size_t vertex) override
+    {
+        events.push_back("f" + std::to_string(vertex));
+        return TraversalControl::Continue;
+    }
+};
+
+/**
+ * DFS preorder of the original stack-based traversal: push every neighbor in reverse.
+ */
+std::vector<int> referenceDepthFirst(const Graph& g, size_t start)
+{
+    std::vector<bool> visited(g.getNumVertices(), false);
+    std::vector<int> order;
+    std::stack<int> toTraverse;
+    toTraverse.push(static_cast<int>(start));
+    while (!toTraverse.empty()) {
+        size_t vertex = static_cast<size_t>(toTraverse.top());
+        toTraverse.pop();
+        if (visited[vertex])
+            continue;
+        visited[vertex] = true;
+        order.push_back(static_cast<int>(vertex));
+        std::vector<int> neighbors = g.getNeighbors(vertex);
+        for (size_t i = neighbors.size(); i-- > 0;)
+            if (!visited[static_cast<size_t>(neighbors[i])])
+                toTraverse.push(neighbors[i]);
+    }
+    return order;
+}
+
+} // namespace
+
+TEST_F(GraphTest, VisitorTraversalEvents)
+{
+    Graph g(4);
+    g.addEdge(0, 1);
+    g.addEdge(0, 2);
+    g.addEdge(1, 2);
+    g.addEdge(2, 3);
+
+    LoggingVisitor dfs;
+    EXPECT_TRUE(g.depthFirstVisit(0, dfs));
+    EXPECT_EQ(dfs.events,
+        (std::vector<std::string> {
+            "d0", "e01", "d1", "e12", "d2", "e23", "d3", "f3", "f2", "f1", "e02", "f0" }));
+
+    LoggingVisitor bfs;
+    EXPECT_TRUE(g.breadthFirstVisit(0, bfs));
+    EXPECT_EQ(bfs.events,
+        (std::vector<std::string> {
+            "d0", "e01", "d1", "e02", "d2", "f0", "e12", "f1", "e23", "d3", "f2", "f3" }));
+
+    // Stopping ends the traversal at once; pruning skips a vertex's out-edges.
+    LoggingVisitor stopped;
+    stopped.stopAt = 1;
+    EXPECT_FALSE(g.depthFirstVisit(0, stopped));
+    EXPECT_EQ(stopped.events, (std::vector<std::string> { "d0", "e01", "d1" }));
+
+    LoggingVisitor pruned;
+    pruned.pruneAt = 1;
+    EXPECT_TRUE(g.breadthFirstVisit(0, pruned));
+    EXPECT_EQ(pruned.events,
+        (std::vector<std::string> {
+            "d0", "e01", "d1", "f1", "e02", "d2", "f0", "e23", "d3", "f2", "f3" }));
+
+    EXPECT_THROW(g.depthFirstVisit(4, dfs), std::out_of_range);
+    EXPECT_THROW(g.breadthFirstVisit(4, bfs), std::out_of_range);
+}
+
+TEST_F(GraphTest, VisitorTraversalKeepsDepthFirstOrder)
+{
+    for (int trial = 0; trial < 5; ++trial) {
+        Graph g = createRandomGraph(40, 0.08, false);
+        for (size_t start = 0; start < g.getNumVertices(); start += 7)
+            EXPECT_EQ(g.depthFirstTraversal(start), referenceDepthFirst(g, start));
+    }
+}
+
+TEST_F(GraphTest, LazyTraversalRanges)
+{
+    for (int trial = 0; trial < 3; ++trial) {
+        Graph g = createRandomGraph(30, 0.1, false);
+        for (size_t start = 0; start < g.getNumVertices(); start += 5) {
+            std::vector<int> dfs, bfs;
+            for (int vertex : g.depthFirstRange(start))
+                dfs.push_back(vertex);
+            for (int vertex : g.breadthFirstRange(start))
+                bfs.push_back(vertex);
+            EXPECT_EQ(dfs, g.depthFirstTraversal(start));
+            EXPECT_EQ(bfs, g.breadthFirstTraversal(start));
+        }
+    }
+
+    // Ranges compose with views and stop after the first k vertices.
+    Graph path(100);
+    for (size_t i = 0; i + 1 < path.getNumVertices(); ++i)
+        path.addEdge(i, i + 1);
+    std::vector<int> firstThree;
+    for (int vertex : path.breadthFirstRange(10) | std::views::take(3))
+        firstThree.push_back(vertex);
+    EXPECT_EQ(firstThree, (std::vector<int> { 10, 11, 12 }));
+
+    EXPECT_THROW(path.depthFirstRange(100), std::out_of_range);
+    EXPECT_THROW(path.breadthFirstRange(100), std::out_of_range);
+}
+
+TEST_F(GraphTest, TraversalWorkspaceReuse)
+{
+    TraversalWorkspace workspace;
+    for (size_t size : { 25u, 10u, 40u }) {
+        Graph g = createRandomGraph(size, 0.1, false);
+        for (size_t start = 0; start < size; ++start) {
+            EXPECT_EQ(g.depthFirstTraversal(start, workspace), g.depthFirstTraversal(start));
+            EXPECT_EQ(g.breadthFirstTraversal(start, workspace), g.breadthFirstTraversal(start));
+            EXPECT_EQ(workspace.getOrder(), g.breadthFirstTraversal(start));
+            size_t other = (start * 7) % size;
+            EXPECT_EQ(g.areVerticesStronglyConnected(start, other, workspace),
+                g.areVerticesStronglyConnected(start, other));
+        }
+    }
+
+    Graph g(2);
+    EXPECT_THROW(g.depthFirstTraversal(2, workspace), std::out_of_range);
+    EXPECT_THROW(g.areVerticesStronglyConnected(0, 2, workspace), std::out_of_range);
+}
+
+TEST_F(GraphTest, KHopNeighborhoodAndEgoNetwork)
+{
+    Graph g = createRandomGraph(40, 0.06, false);
+    TraversalWorkspace workspace;
+    for (size_t start = 0; start < g.getNumVertices(); start += 3) {
+        // Hop counts from a full BFS; the k-hop result is the BFS order cut at depth k.
+        std::vector<int> order = g.breadthFirstTraversal(start);
+        std::vector<int> hops(g.getNumVertices(), -1);
+        hops[start] = 0;
+        for (int u : order)
+            for (int v : g.getNeighbors(static_cast<size_t>(u)))
+                if (hops[static_cast<size_t>(v)] < 0)
+                    hops[static_cast<size_t>(v)] = hops[static_cast<size_t>(u)] + 1;
+
+        for (int k = 0; k <= 4; ++k) {
+            size_t within = 0;
+            for (int h : hops)
+                within += h >= 0 && h <= k;
+            std::vector<int> expected(order.begin(), order.begin() + within);
+            EXPECT_EQ(g.kHopNeighborhood(start, static_cast<size_t>(k)), expected);
+            EXPECT_EQ(g.kHopNeighborhood(start, static_cast<size_t>(k), workspace), expected);
+        }
+    }
+
+    Graph weighted(5, true);
+    weighted.addEdge(0, 1, 3);
+    weighted.addEdge(1, 2, 4);
+    weighted.addEdge(2, 0, 5);
+    weighted.addEdge(2, 3, 6);
+    weighted.addEdge(3, 4, 7);
+    std::vector<int> vertices;
+    Graph ego = weighted.egoNetwork(1, 1, &vertices);
+    EXPECT_EQ(vertices, (std::vector<int> { 1, 2 }));
+    EXPECT_EQ(ego.getNumVertices(), 2u);
+    EXPECT_EQ(ego.getEdgeWeight(0, 1), 4);
+    EXPECT_FALSE(ego.isAdjacent(1, 0));
+
+    ego = weighted.egoNetwork(0, 2);
+    EXPECT_EQ(ego.getNumVertices(), 3u);
+    EXPECT_EQ(ego.getEdgeWeight(2, 0), 5);
+
+    EXPECT_THROW(weighted.kHopNeighborhood(5, 1), std::out_of_range);
+    EXPECT_THROW(weighted.egoNetwork(5, 1), std::out_of_range);
+}
+
+TEST_F(GraphTest, IncrementalConnectivity)
+{
+    Graph g(30);
+    std::mt19937 gen(17);
+    std::uniform_int_distribution<size_t> vertexDist(0, 29);
+    std::uniform_int_distribution<int> actionDist(0, 9);
+
+    for (int step = 0; step < 300; ++step) {
+        size_t u = vertexDist(gen);
+        size_t v = vertexDist(gen);
+        int action = actionDist(gen);
+        if (action < 5)
+            g.addEdge(u, v);
+        else if (action < 8)
+            g.addUndirectedEdge(u, v, 1);
+        else
+            g.removeEdge(u, v);
+
+        // Reference: weak components from a DFS over edges in both directions.
+        size_t n = g.getNumVertices();
+        std::vector<int> label(n, -1);
+        size_t components = 0;
+        for (size_t root = 0; root < n; ++root) {
+            if (label[root] >= 0)
+                continue;
+            ++components;
+            std::vector<size_t> stack { root };
+            label[root] = static_cast<int>(root);
+            while (!stack.empty()) {
+                size_t x = stack.back();
+                stack.pop_back();
+                for (size_t y = 0; y < n; ++y)
+                    if (label[y] < 0 && (g.isAdjacent(x, y) || g.isAdjacent(y, x))) {
+                        label[y] = static_cast<int>(root);
+                        stack.push_back(y);
+                    }
+            }
+        }
+
+        ASSERT_EQ(g.getNumConnectedComponents(), components) << "step " << step;
+        EXPECT_EQ(g.areVerticesConnected(u, v), label[u] == label[v]);
+        bool rooted = false;
+        for (size_t root = 0; root < n && !rooted; ++root)
+            rooted = g.depthFirstTraversal(root).size() == n;
+        EXPECT_EQ(g.isConnected(), rooted);
+    }
+
+    // Vertex changes, copies and moves carry the structure along.
+    g.addVertex();
+    EXPECT_FALSE(g.areVerticesConnected(0, 30));
+    g.addEdge(30, 0);
+    Graph copy(g);
+    EXPECT_TRUE(copy.areVerticesConnected(0, 30));
+    copy.removeVertex(0);
+    EXPECT_EQ(copy.getNumConnectedComponents(), copy.transpose().getNumConnectedComponents());
+    Graph moved(std::move(copy));
+    EXPECT_EQ(moved.getNumVertices(), 30u);
+    EXPECT_EQ(copy.getNumConnectedComponents(), 0u);
+
+    Graph undirected(3);
+    undirected.addUndirectedEdge(0, 1, 1);
+    undirected.addUndirectedEdge(1, 2, 1);
+    EXPECT_TRUE(undirected.isConnected());
+    undirected.removeEdge(1, 2);
+    EXPECT_TRUE(undirected.isConnected());
+    undirected.removeEdge(2, 1);
+    EXPECT_FALSE(undirected.isConnected());
+    EXPECT_THROW(undirected.areVerticesConnected(0, 3), std::out_of_range);
+}
+
+TEST_F(GraphTest, TransposeReversesEdges)
+{
+    Graph g(3, true);
+    g.addEdge(0, 1, 4);
+    g.addEdge(1, 2, 7);
+
+    Graph t = g.transpose();
+
+    EXPECT_TRUE(t.getIsWeighted());
+    EXPECT_TRUE(t.isAdjacent(1, 0));
+    EXPECT_TRUE(t.isAdjacent(2, 1));
+    EXPECT_FALSE(t.isAdjacent(0, 1));
+    EXPECT_EQ(t.getEdgeWeight(2, 1), 7);
+    EXPECT_EQ(t.getNumVertices(), 3u);
+}
+
 // ============================================================
 // Exception Tests — verify every throw path
 // ============================================================
@@ -0,0 +1,86 @@
+#include "../include/IncrementalTopologicalOrder.h"
+#include <gtest/gtest.h>
+#include <random>
+
+class IncrementalTopologicalOrderTest : public ::testing::Test {
+protected:
+    // Helper method to check that every edge of g points forward in the maintained order
+    void expectValidOrder(const Graph& g, const IncrementalTopologicalOrder& order)
+    {
+        std::vector<int> sorted = order.order();
+        std::sort(sorted.begin(), sorted.end());
+        for (size_t v = 0; v < g.getNumVertices(); ++v) {
+            ASSERT_EQ(sorted[v], static_cast<int>(v));
+            EXPECT_EQ(order.order()[order.getPosition(v)], static_cast<int>(v));
+        }
+        for (size_t u = 0; u < g.getNumVertices(); ++u)
+            for (int v : g.getNeighbors(u))
+                EXPECT_LT(order.getPosition(u), order.getPosition(static_cast<size_t>(v)));
+    }
+};
+
+TEST_F(IncrementalTopologicalOrderTest, RejectsExactlyTheCycleCreatingEdges)
+{
+    const size_t n = 60;
+    Graph g(n);
+    IncrementalTopologicalOrder order(n);
+    std::mt19937 gen(21);
+    std::uniform_int_distribution<size_t> vertexDist(0, n - 1);
+    std::uniform_int_distribution<int> actionDist(0, 9);
+    TraversalWorkspace workspace;
+
+    for (int step = 0; step < 1500; ++step) {
+        size_t u = vertexDist(gen);
+        size_t v = vertexDist(gen);
+        if (actionDist(gen) == 0) {
+            g.removeEdge(u, v);
+            order.removeEdge(u, v);
+            EXPECT_FALSE(order.hasEdge(u, v));
+            continue;
+        }
+
+        // The edge closes a cycle iff v already reaches u.
+        const std::vector<int>& reached = g.depthFirstTraversal(v, workspace);
+        bool cycle
+            = std::find(reached.begin(), reached.end(), static_cast<int>(u)) != reached.end();
+        EXPECT_EQ(order.addEdge(u, v), !cycle) << "step " << step;
+        if (!cycle)
+            g.addEdge(u, v);
+        EXPECT_EQ(order.hasEdge(u, v), !cycle);
+        expectValidOrder(g, order);
+    }
+
+    EXPECT_THROW(order.addEdge(0, n), std::out_of_range);
+    EXPECT_THROW(order.getPosition(n), std::out_of_range);
+}
+
+TEST_F(IncrementalTopologicalOrderTest, ReordersOnlyTheAffectedRegion)
+{
+    // Chain 0 -> 1 -> ... -> 99 built from a graph, then a backward edge near the end.
+    Graph chain(100);
+    for (size_t v = 0; v + 1 < 100; ++v)
+        chain.addEdge(v, v + 1);
+    IncrementalTopologicalOrder order(chain);
+
+    EXPECT_TRUE(order.addEdge(10, 50));
+    EXPECT_EQ(order.getLastReorderSize(), 0u);
+    EXPECT_FALSE(order.addEdge(99, 0));
+    EXPECT_FALSE(order.addEdge(7, 7));
+
+    order.addVertex();
+    order.addVertex();
+    EXPECT_TRUE(order.addEdge(101, 100));
+    EXPECT_EQ(order.getLastReorderSize(), 2u);
+    // Only 98 and 99 follow the new edge's head, and only 101 and 100 lead to its tail.
+    EXPECT_TRUE(order.addEdge(100, 98));
+    EXPECT_EQ(order.getLastReorderSize(), 4u);
+    EXPECT_LT(order.getPosition(101), order.getPosition(100));
+    EXPECT_LT(order.getPosition(100), order.getPosition(98));
+    EXPECT_LT(order.getPosition(97), order.getPosition(98));
+    EXPECT_EQ(order.getPosition(50), 50u);
+
+    Graph cyclic(2);
+    cyclic.addEdge(0, 1);
+    cyclic.addEdge(1, 0);
+    EXPECT_THROW(IncrementalTopologicalOrder { cyclic }, std::runtime_error);
+}
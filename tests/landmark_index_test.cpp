@@ -0,0 +1,125 @@
+#include "../include/LandmarkIndex.h"
+#include <cstdint>
+#include <cstring>
+#include <gtest/gtest.h>
+#include <limits>
+#include <random>
+#include <set>
+#include <sstream>
+
+class LandmarkIndexTest : public ::testing::Test {
+protected:
+    // Helper method to create a random directed graph with a Hamiltonian backbone
+    Graph createRoadLikeGraph(size_t numVertices, double extraEdgeProbability)
+    {
+        Graph g(numVertices, true);
+        std::mt19937 gen(42);
+        std::uniform_real_distribution<> edgeDist(0.0, 1.0);
+        std::uniform_int_distribution<> weightDist(1, 50);
+
+        for (size_t i = 0; i + 1 < numVertices; ++i)
+            g.addUndirectedEdge(i, i + 1, weightDist(gen));
+
+        for (size_t i = 0; i < numVertices; ++i)
+            for (size_t j = 0; j < numVertices; ++j)
+                if (i != j && !g.isAdjacent(i, j) && edgeDist(gen) < extraEdgeProbability)
+                    g.addEdge(i, j, weightDist(gen));
+        return g;
+    }
+
+    void expectValidBounds(const Graph& g, const LandmarkIndex& index)
+    {
+        for (size_t s = 0; s < g.getNumVertices(); ++s) {
+            std::vector<int> dist = dijkstra(g, s).first;
+            for (size_t t = 0; t < g.getNumVertices(); ++t) {
+                if (dist[t] != std::numeric_limits<int>::max()) {
+                    EXPECT_LE(index.lowerBound(s, t), dist[t]);
+                }
+            }
+        }
+    }
+};
+
+TEST_F(LandmarkIndexTest, FarthestPointBoundsAreAdmissible)
+{
+    Graph g = createRoadLikeGraph(40, 0.05);
+    LandmarkIndex index(g, 4, LandmarkSelection::FarthestPoint, 2);
+
+    std::set<int> distinct(index.getLandmarks().begin(), index.getLandmarks().end());
+    EXPECT_EQ(index.getLandmarks().size(), 4u);
+    EXPECT_EQ(distinct.size(), 4u);
+    expectValidBounds(g, index);
+}
+
+TEST_F(LandmarkIndexTest, AvoidBoundsAreAdmissible)
+{
+    Graph g = createRoadLikeGraph(40, 0.05);
+    LandmarkIndex index(g, 4, LandmarkSelection::Avoid, 2);
+
+    std::set<int> distinct(index.getLandmarks().begin(), index.getLandmarks().end());
+    EXPECT_EQ(distinct.size(), 4u);
+    expectValidBounds(g, index);
+}
+
+TEST_F(LandmarkIndexTest, AStarWithIndexMatchesDijkstra)
+{
+    Graph g = createRoadLikeGraph(30, 0.1);
+    LandmarkIndex index(g, 3);
+
+    for (size_t s = 0; s < g.getNumVertices(); s += 7) {
+        std::vector<int> expected = dijkstra(g, s).first;
+        for (size_t t = 0; t < g.getNumVertices(); ++t) {
+            auto [dist, pred] = aStar(g, s, t, index.heuristic(t));
+            EXPECT_EQ(dist[t], expected[t]);
+        }
+    }
+}
+
+TEST_F(LandmarkIndexTest, SaveLoadRoundTrip)
+{
+    Graph g = createRoadLikeGraph(20, 0.1);
+    LandmarkIndex index(g, std::vector<int> { 0, 7, 19 });
+
+    std::stringstream buffer;
+    index.save(buffer);
+    LandmarkIndex loaded = LandmarkIndex::load(buffer);
+
+    EXPECT_EQ(loaded.getNumVertices(), index.getNumVertices());
+    EXPECT_EQ(loaded.getLandmarks(), index.getLandmarks());
+    for (size_t s = 0; s < g.getNumVertices(); ++s)
+        for (size_t t = 0; t < g.getNumVertices(); ++t)
+            EXPECT_EQ(loaded.lowerBound(s, t), index.lowerBound(s, t));
+}
+
+TEST_F(LandmarkIndexTest, ErrorHandling)
+{
+    Graph g(3, true);
+    g.addEdge(0, 1, 2);
+
+    EXPECT_THROW(LandmarkIndex(g, std::vector<int> { 3 }), std::out_of_range);
+
+    LandmarkIndex index(g, 10);
+    EXPECT_EQ(index.getLandmarks().size(), 3u);
+    EXPECT_THROW(index.lowerBound(0, 3), std::out_of_range);
+    EXPECT_THROW(index.heuristic(5), std::out_of_range);
+
+    std::stringstream garbage("not an index");
+    EXPECT_THROW(LandmarkIndex::load(garbage), std::runtime_error);
+
+    std::stringstream truncated;
+    index.save(truncated);
+    std::string bytes = truncated.str();
+    std::stringstream cut(bytes.substr(0, bytes.size() - 1));
+    EXPECT_THROW(LandmarkIndex::load(cut), std::runtime_error);
+
+    // Corrupt counts must fail on the stream contents, not in a huge allocation.
+    auto loadWithCount = [&](size_t offset, std::uint64_t count) {
+        std::string corrupt = bytes;
+        std::memcpy(corrupt.data() + offset, &count, sizeof(count));
+        std::stringstream stream(corrupt);
+        return LandmarkIndex::load(stream);
+    };
+    EXPECT_THROW(loadWithCount(8, std::numeric_limits<int>::max()), std::runtime_error);
+    EXPECT_THROW(loadWithCount(8, std::uint64_t { 1 } << 40), std::runtime_error);
+    EXPECT_THROW(loadWithCount(16, std::uint64_t { 1 } << 40), std::runtime_error);
+}
@@ -0,0 +1,51 @@
+#include "../include/Algorithms.h"
+#include "../include/MaskedGraphView.h"
+#include <gtest/gtest.h>
+#include <limits>
+
+class MaskedGraphViewTest : public ::testing::Test { };
+
+TEST_F(MaskedGraphViewTest, HideAndShowAll)
+{
+    CsrGraph csr(3, { { 0, 1, 4 }, { 0, 2, 1 }, { 0, 1, 7 }, { 2, 1, 1 } });
+    MaskedGraphView view(csr);
+
+    EXPECT_EQ(&view.getGraph(), &csr);
+    EXPECT_FALSE(view.isEdgeHidden(0));
+
+    view.hideEdges(0, 1);
+    view.hideVertex(2);
+    EXPECT_TRUE(view.isEdgeHidden(0));
+    EXPECT_FALSE(view.isEdgeHidden(1));
+    EXPECT_TRUE(view.isEdgeHidden(2));
+    EXPECT_TRUE(view.isVertexHidden(2));
+
+    view.showAll();
+    for (size_t e = 0; e < csr.getNumEdges(); ++e)
+        EXPECT_FALSE(view.isEdgeHidden(e));
+    EXPECT_FALSE(view.isVertexHidden(2));
+
+    EXPECT_THROW(view.hideEdge(4), std::out_of_range);
+    EXPECT_THROW(view.hideVertex(3), std::out_of_range);
+    EXPECT_THROW(view.hideEdges(3, 0), std::out_of_range);
+}
+
+TEST_F(MaskedGraphViewTest, DijkstraSkipsHiddenEdgesAndVertices)
+{
+    CsrGraph csr(4, { { 0, 1, 1 }, { 1, 3, 1 }, { 0, 2, 2 }, { 2, 3, 2 }, { 0, 3, 10 } });
+    MaskedGraphView view(csr);
+    ShortestPathWorkspace workspace;
+
+    dijkstra(view, 0, 3, workspace);
+    EXPECT_EQ(workspace.getDistance(3), 2);
+
+    view.hideVertex(1);
+    dijkstra(view, 0, 3, workspace);
+    EXPECT_EQ(workspace.getDistance(3), 4);
+    EXPECT_EQ(workspace.getPredecessor(3), 2);
+
+    view.hideEdge(4); // 2 -> 3
+    dijkstra(view, 0, 4, workspace);
+    EXPECT_EQ(workspace.getDistance(3), 10);
+    EXPECT_EQ(workspace.getDistance(1), std::numeric_limits<int>::max());
+}
@@ -0,0 +1,97 @@
+#include "../include/ReachabilityIndex.h"
+#include <cstdint>
+#include <cstring>
+#include <gtest/gtest.h>
+#include <limits>
+#include <random>
+#include <sstream>
+
+class ReachabilityIndexTest : public ::testing::Test {
+protected:
+    // Helper method to create a sparse random directed graph with some cycles
+    Graph createDependencyGraph(size_t numVertices, size_t numEdges, unsigned seed)
+    {
+        Graph g(numVertices);
+        std::mt19937 gen(seed);
+        std::uniform_int_distribution<size_t> vertexDist(0, numVertices - 1);
+        for (size_t i = 0; i < numEdges; ++i)
+            g.addEdge(vertexDist(gen), vertexDist(gen), 1);
+        return g;
+    }
+};
+
+TEST_F(ReachabilityIndexTest, MatchesTraversal)
+{
+    Graph g = createDependencyGraph(150, 180, 7);
+    ReachabilityIndex index(g);
+    ASSERT_EQ(index.getNumVertices(), 150u);
+
+    TraversalWorkspace workspace;
+    for (size_t u = 0; u < g.getNumVertices(); ++u) {
+        std::vector<bool> reached(g.getNumVertices(), false);
+        const std::vector<int>& order = g.depthFirstTraversal(u, workspace);
+        for (int v : order)
+            reached[static_cast<size_t>(v)] = true;
+
+        EXPECT_EQ(index.countReachable(u), order.size());
+        for (size_t v = 0; v < g.getNumVertices(); ++v) {
+            EXPECT_EQ(index.canReach(u, v), reached[v]);
+            EXPECT_EQ(index.areStronglyConnected(u, v), g.areVerticesStronglyConnected(u, v));
+        }
+    }
+
+    // Components are numbered in topological order.
+    for (size_t u = 0; u < g.getNumVertices(); ++u)
+        for (int v : g.getNeighbors(u))
+            EXPECT_LE(index.getComponent(u), index.getComponent(static_cast<size_t>(v)));
+}
+
+TEST_F(ReachabilityIndexTest, CyclesAndSerialization)
+{
+    // 0 <-> 1 -> 2 -> 3 <-> 4, and 5 on its own.
+    Graph g(6);
+    g.addEdge(0, 1, 1);
+    g.addEdge(1, 0, 1);
+    g.addEdge(1, 2, 1);
+    g.addEdge(2, 3, 1);
+    g.addEdge(3, 4, 1);
+    g.addEdge(4, 3, 1);
+
+    ReachabilityIndex index(CsrGraph { g });
+    EXPECT_EQ(index.getNumComponents(), 4u);
+    EXPECT_TRUE(index.areStronglyConnected(3, 4));
+    EXPECT_TRUE(index.canReach(0, 4));
+    EXPECT_FALSE(index.canReach(4, 0));
+    EXPECT_FALSE(index.canReach(0, 5));
+    EXPECT_TRUE(index.canReach(5, 5));
+    EXPECT_EQ(index.countReachable(1), 5u);
+
+    std::stringstream stream;
+    index.save(stream);
+    ReachabilityIndex loaded = ReachabilityIndex::load(stream);
+    for (size_t u = 0; u < 6; ++u) {
+        EXPECT_EQ(loaded.getComponent(u), index.getComponent(u));
+        for (size_t v = 0; v < 6; ++v)
+            EXPECT_EQ(loaded.canReach(u, v), index.canReach(u, v));
+    }
+
+    EXPECT_THROW(index.canReach(0, 6), std::out_of_range);
+    EXPECT_THROW(index.getComponent(6), std::out_of_range);
+    std::stringstream garbage("not an index");
+    EXPECT_THROW(ReachabilityIndex::load(garbage), std::runtime_error);
+
+    // Truncated or corrupt streams fail on their contents, not in a huge allocation.
+    const std::string bytes = stream.str();
+    std::stringstream cut(bytes.substr(0, bytes.size() - 1));
+    EXPECT_THROW(ReachabilityIndex::load(cut), std::runtime_error);
+    auto loadWithCount = [&](size_t offset, std::uint64_t count) {
+        std::string corrupt = bytes;
+        std::memcpy(corrupt.data() + offset, &count, sizeof(count));
+        std::stringstream in(corrupt);
+        return ReachabilityIndex::load(in);
+    };
+    EXPECT_THROW(loadWithCount(8, std::numeric_limits<int>::max()), std::runtime_error);
+    EXPECT_THROW(loadWithCount(8, std::uint64_t { 1 } << 40), std::runtime_error);
+    EXPECT_THROW(loadWithCount(16, 5), std::runtime_error);
+    EXPECT_EQ(ReachabilityIndex().getNumComponents(), 0u);
+}
@@ -0,0 +1,83 @@
+#include "../include/ShortestPathTree.h"
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <iterator>
+#include <vector>
+
+class ShortestPathTreeTest : public ::testing::Test { };
+
+static_assert(std::forward_iterator<ShortestPathTree::PathIterator>);
+
+TEST_F(ShortestPathTreeTest, PathsAndSubtrees)
+{
+    // Tree edges 0->1, 0->2, 1->3, 2->4; vertex 5 is unreachable.
+    Graph graph(6);
+    graph.addEdge(0, 1, 1);
+    graph.addEdge(0, 2, 4);
+    graph.addEdge(1, 3, 2);
+    graph.addEdge(2, 4, 1);
+    graph.addEdge(3, 4, 9);
+    ShortestPathTree tree(dijkstra(graph, 0), 0);
+    // Only distances and parents until a subtree query needs the preorder layout.
+    EXPECT_EQ(tree.getMemoryUsage(), 6 * (sizeof(int) + sizeof(std::int32_t)));
+
+    EXPECT_EQ(tree.getSource(), 0u);
+    EXPECT_EQ(tree.getDistance(4), 5);
+    EXPECT_EQ(tree.getParent(4), 2);
+    EXPECT_EQ(tree.getDepth(3), 2);
+    EXPECT_FALSE(tree.isReachable(5));
+    EXPECT_EQ(tree.getDepth(5), -1);
+
+    std::vector<int> reversed(tree.path(3).begin(), tree.path(3).end());
+    EXPECT_EQ(reversed, (std::vector<int> { 3, 1, 0 }));
+    EXPECT_EQ(tree.path(3).size(), 3u);
+    EXPECT_TRUE(tree.path(5).empty());
+
+    std::vector<int> buffer { 7, 7, 7, 7, 7 };
+    tree.copyPath(4, buffer);
+    EXPECT_EQ(buffer, (std::vector<int> { 0, 2, 4 }));
+    tree.copyPath(0, buffer);
+    EXPECT_EQ(buffer, (std::vector<int> { 0 }));
+    tree.copyPath(5, buffer);
+    EXPECT_TRUE(buffer.empty());
+
+    ShortestPathTree copy = tree;
+    EXPECT_TRUE(copy.isAncestor(0, 4));
+    EXPECT_EQ(tree.getMemoryUsage(), 6 * (sizeof(int) + sizeof(std::int32_t)));
+    EXPECT_TRUE(tree.isAncestor(0, 4));
+    EXPECT_TRUE(tree.isAncestor(1, 3));
+    EXPECT_TRUE(tree.isAncestor(3, 3));
+    EXPECT_FALSE(tree.isAncestor(1, 4));
+    EXPECT_FALSE(tree.isAncestor(5, 5));
+
+    auto sub = tree.subtree(1);
+    EXPECT_EQ(std::vector<int>(sub.begin(), sub.end()), (std::vector<int> { 1, 3 }));
+    EXPECT_EQ(tree.subtree(0).size(), 5u);
+    EXPECT_TRUE(tree.subtree(5).empty());
+    // The preorder holds the 5 reachable vertices.
+    EXPECT_EQ(tree.getMemoryUsage(),
+        6 * (sizeof(int) + 3 * sizeof(std::int32_t)) + 5 * sizeof(std::int32_t));
+
+    EXPECT_THROW(tree.path(6), std::out_of_range);
+    EXPECT_THROW(tree.isAncestor(0, 6), std::out_of_range);
+}
+
+TEST_F(ShortestPathTreeTest, BuildsFromWorkspacesAndRejectsBadInput)
+{
+    CsrGraph csr(4, { { 0, 1, 3 }, { 1, 2, 3 }, { 0, 2, 10 }, { 2, 3, 1 } });
+    BasicShortestPathWorkspace<double> workspace;
+    dijkstra(csr, 0, workspace);
+    BasicShortestPathTree<double> tree(workspace, 0);
+    EXPECT_DOUBLE_EQ(tree.getDistance(3), 7.0);
+
+    std::vector<int> path;
+    tree.copyPath(3, path);
+    EXPECT_EQ(path, (std::vector<int> { 0, 1, 2, 3 }));
+
+    std::vector<int> distances { 0, 1, 2 };
+    EXPECT_THROW(ShortestPathTree(distances, { -1, 0 }, 0), std::invalid_argument);
+    EXPECT_THROW(ShortestPathTree(distances, { -1, 0, 1 }, 3), std::out_of_range);
+    EXPECT_THROW(ShortestPathTree(distances, { 1, 0, -1 }, 0), std::invalid_argument);
+    EXPECT_THROW(ShortestPathTree(distances, { -1, 2, 1 }, 0), std::invalid_argument);
+    EXPECT_THROW(ShortestPathTree(distances, { -1, 3, 0 }, 0), std::invalid_argument);
+}
@@ -0,0 +1,148 @@
+#include "../include/Traversal.h"
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <queue>
+#include <random>
+
+class TraversalTest : public ::testing::Test { };
+
+namespace {
+
+/**
+ * Random graph with a few hubs, so frontiers grow large after one or two levels.
+ */
+CsrGraph socialGraph(size_t n, unsigned seed)
+{
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int> vertex(0, static_cast<int>(n) - 1);
+    std::vector<CsrGraph::Edge> edges;
+    for (size_t i = 0; i < 4 * n; ++i) {
+        int hub = vertex(rng) % 8;
+        edges.push_back({ vertex(rng), vertex(rng), 1 });
+        edges.push_back({ hub, vertex(rng), 1 });
+        edges.push_back({ vertex(rng), hub, 1 });
+    }
+    return CsrGraph(n, edges);
+}
+
+/**
+ * Levels of a plain queue-based BFS.
+ */
+std::vector<int> referenceLevels(const CsrGraph& graph, size_t source)
+{
+    std::vector<int> levels(graph.getNumVertices(), -1);
+    std::queue<int> queue;
+    levels[source] = 0;
+    queue.push(static_cast<int>(source));
+    while (!queue.empty()) {
+        int u = queue.front();
+        queue.pop();
+        for (int v : graph.getNeighbors(static_cast<size_t>(u)))
+            if (levels[static_cast<size_t>(v)] < 0) {
+                levels[static_cast<size_t>(v)] = levels[static_cast<size_t>(u)] + 1;
+                queue.push(v);
+            }
+    }
+    return levels;
+}
+
+/**
+ * Checks levels against the reference and that every parent is an edge one level up.
+ */
+void expectValidBfs(const CsrGraph& graph, size_t source, const BreadthFirstResult& result)
+{
+    EXPECT_EQ(result.levels, referenceLevels(graph, source));
+    EXPECT_EQ(result.order.front(), static_cast<int>(source));
+    EXPECT_EQ(result.parents[source], -1);
+
+    int previous = 0;
+    for (int vertex : result.order) {
+        size_t v = static_cast<size_t>(vertex);
+        EXPECT_GE(result.levels[v], previous);
+        previous = result.levels[v];
+        if (v == source)
+            continue;
+        int parent = result.parents[v];
+        ASSERT_GE(parent, 0);
+        EXPECT_EQ(result.levels[static_cast<size_t>(parent)] + 1, result.levels[v]);
+        std::span<const int> neighbors = graph.getNeighbors(static_cast<size_t>(parent));
+        EXPECT_NE(std::find(neighbors.begin(), neighbors.end(), vertex), neighbors.end());
+    }
+
+    size_t reached = 0;
+    for (int level : result.levels)
+        reached += level >= 0;
+    EXPECT_EQ(result.order.size(), reached);
+}
+
+} // namespace
+
+TEST_F(TraversalTest, DirectionOptimizingBfsMatchesQueueBfs)
+{
+    CsrGraph graph = socialGraph(500, 3);
+    CsrGraph reverse = graph.transpose();
+
+    for (size_t source : { 0, 17, 499 }) {
+        // Default switching, never bottom-up, and bottom-up from the first level on.
+        expectValidBfs(graph, source, directionOptimizingBfs(graph, reverse, source));
+        expectValidBfs(graph, source, directionOptimizingBfs(graph, reverse, source, 1, 1));
+        expectValidBfs(graph, source,
+            directionOptimizingBfs(graph, reverse, source, graph.getNumEdges() + 1, 1000000));
+    }
+
+    // A path with an unreachable tail stays correct through every switch.
+    CsrGraph path(6, { { 0, 1, 1 }, { 1, 2, 1 }, { 2, 3, 1 }, { 5, 4, 1 } });
+    BreadthFirstResult result = directionOptimizingBfs(path, 0);
+    EXPECT_EQ(result.levels, (std::vector<int> { 0, 1, 2, 3, -1, -1 }));
+    EXPECT_EQ(result.order, (std::vector<int> { 0, 1, 2, 3 }));
+}
+
+TEST_F(TraversalTest, DirectionOptimizingBfsErrors)
+{
+    Graph graph(3);
+    graph.addEdge(0, 1, 1);
+    EXPECT_EQ(directionOptimizingBfs(graph, 0).parents, (std::vector<int> { -1, 0, -1 }));
+
+    CsrGraph csr(graph);
+    EXPECT_THROW(directionOptimizingBfs(graph, 3), std::out_of_range);
+    EXPECT_THROW(directionOptimizingBfs(csr, CsrGraph(), 0), std::invalid_argument);
+    EXPECT_THROW(directionOptimizingBfs(csr, csr.transpose(), 0, 0, 1), std::invalid_argument);
+}
+
+TEST_F(TraversalTest, ParallelBfsMatchesQueueBfs)
+{
+    CsrGraph graph = socialGraph(2000, 11);
+    for (size_t threads : { 1, 2, 4 })
+        for (size_t source : { 0, 1234 })
+            expectValidBfs(graph, source, parallelBfs(graph, source, threads));
+
+    CsrGraph path(5, { { 0, 1, 1 }, { 1, 2, 1 }, { 4, 3, 1 } });
+    BreadthFirstResult result = parallelBfs(path, 0, 3);
+    EXPECT_EQ(result.levels, (std::vector<int> { 0, 1, 2, -1, -1 }));
+    EXPECT_EQ(result.order, (std::vector<int> { 0, 1, 2 }));
+
+    EXPECT_THROW(parallelBfs(path, 5), std::out_of_range);
+}
+
+TEST_F(TraversalTest, MultiSourceBfsMatchesSingleSource)
+{
+    CsrGraph graph = socialGraph(300, 5);
+    std::vector<int> sources;
+    for (int i = 0; i < 150; ++i)
+        sources.push_back((i * 37) % 300);
+    sources.push_back(sources.front());
+
+    for (size_t threads : { 1, 3 }) {
+        std::vector<std::vector<int>> levels = multiSourceBfs(graph, sources, threads);
+        ASSERT_EQ(levels.size(), sources.size());
+        for (size_t i = 0; i < sources.size(); ++i)
+            EXPECT_EQ(levels[i], referenceLevels(graph, static_cast<size_t>(sources[i])));
+    }
+
+    Graph small(3);
+    small.addEdge(0, 1, 1);
+    EXPECT_EQ(multiSourceBfs(small, { 0, 2 }),
+        (std::vector<std::vector<int>> { { 0, 1, -1 }, { -1, -1, 0 } }));
+    EXPECT_TRUE(multiSourceBfs(small, {}).empty());
+    EXPECT_THROW(multiSourceBfs(small, { 3 }), std::out_of_range);
+}
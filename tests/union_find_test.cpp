@@ -0,0 +1,64 @@
+#include "../include/UnionFind.h"
+#include <gtest/gtest.h>
+#include <random>
+#include <thread>
+
+class UnionFindTest : public ::testing::Test { };
+
+TEST_F(UnionFindTest, UniteAndFind)
+{
+    ConcurrentUnionFind sets(6);
+    EXPECT_EQ(sets.getNumSets(), 6u);
+    EXPECT_TRUE(sets.unite(4, 5));
+    EXPECT_TRUE(sets.unite(5, 2));
+    EXPECT_FALSE(sets.unite(2, 4));
+    EXPECT_EQ(sets.getNumSets(), 4u);
+
+    // Roots are the smallest element of their set.
+    EXPECT_EQ(sets.find(5), 2);
+    EXPECT_TRUE(sets.connected(4, 2));
+    EXPECT_FALSE(sets.connected(0, 4));
+
+    ConcurrentUnionFind copy = sets;
+    sets.addElement();
+    EXPECT_TRUE(sets.unite(6, 0));
+    EXPECT_EQ(sets.getSize(), 7u);
+    EXPECT_EQ(sets.getNumSets(), 4u);
+    EXPECT_EQ(copy.getNumSets(), 4u);
+    EXPECT_FALSE(copy.connected(0, 1));
+
+    EXPECT_THROW(sets.find(7), std::out_of_range);
+    EXPECT_THROW(sets.unite(0, 7), std::out_of_range);
+    sets.reset(2);
+    EXPECT_EQ(sets.getNumSets(), 2u);
+}
+
+TEST_F(UnionFindTest, ConcurrentUnionsMatchSequential)
+{
+    const size_t n = 5000;
+    std::mt19937 gen(9);
+    std::uniform_int_distribution<size_t> elementDist(0, n - 1);
+    std::vector<std::pair<size_t, size_t>> pairs(4000);
+    for (auto& pair : pairs)
+        pair = { elementDist(gen), elementDist(gen) };
+
+    ConcurrentUnionFind sequential(n);
+    for (auto [a, b] : pairs)
+        sequential.unite(a, b);
+
+    ConcurrentUnionFind shared(n);
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < 4; ++t)
+        threads.emplace_back([&, t]() {
+            for (size_t i = t; i < pairs.size(); i += 4) {
+                shared.unite(pairs[i].first, pairs[i].second);
+                shared.connected(pairs[i].second, pairs[(i + 1) % pairs.size()].first);
+            }
+        });
+    for (std::thread& thread : threads)
+        thread.join();
+
+    EXPECT_EQ(shared.getNumSets(), sequential.getNumSets());
+    for (size_t v = 0; v < n; ++v)
+        EXPECT_EQ(shared.find(v), sequential.find(v));
+}